@@ -0,0 +1,206 @@
+#include "CompactGraph.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Constructs an empty graph.
+ */
+CompactGraph::CompactGraph() : offsets_(1, 0), edges_(0) {}
+
+/**
+ * @brief Returns the number of vertices.
+ */
+size_t CompactGraph::vertexCount() const {
+    return names_.size();
+}
+
+/**
+ * @brief Returns the number of (undirected) edges, each counted once.
+ */
+size_t CompactGraph::edgeCount() const {
+    return edges_;
+}
+
+/**
+ * @brief Returns the name of a vertex.
+ */
+const std::string& CompactGraph::name(const VertexId& v) const {
+    return names_[v];
+}
+
+/**
+ * @brief Looks up the id of a vertex by name.
+ * @throws (std::out_of_range) If there is no vertex of that name.
+ */
+VertexId CompactGraph::id(const std::string& name) const {
+    auto itr = ids_.find(name);
+    if (itr == ids_.end()) {
+        throw std::out_of_range("No vertex " + name);
+    }
+    return itr->second;
+}
+
+/**
+ * @brief Checks if the graph has a vertex of that name.
+ */
+bool CompactGraph::contains(const std::string& name) const {
+    return ids_.count(name) > 0;
+}
+
+/**
+ * @brief Returns the number of neighbours of a vertex (a self-loop counts once).
+ */
+size_t CompactGraph::degree(const VertexId& v) const {
+    return offsets_[v + 1] - offsets_[v];
+}
+
+/**
+ * @brief Returns a pointer to the first neighbour of a vertex, in ascending id order.
+ */
+const VertexId* CompactGraph::neighborsBegin(const VertexId& v) const {
+    return adjacency_.data() + offsets_[v];
+}
+
+/**
+ * @brief Returns a pointer to one past the last neighbour of a vertex.
+ */
+const VertexId* CompactGraph::neighborsEnd(const VertexId& v) const {
+    return adjacency_.data() + offsets_[v + 1];
+}
+
+/**
+ * @brief Returns the id of a vertex name, giving it the next id if it's new.
+ */
+VertexId GraphBuilder::intern(std::string_view name) {
+    key_.assign(name.data(), name.size());
+    auto itr = ids_.find(key_);
+    if (itr != ids_.end()) {
+        return itr->second;
+    }
+    VertexId id = names_.size();
+    ids_.emplace(key_, id);
+    names_.push_back(key_);
+    return id;
+}
+
+/**
+ * @brief Adds the undirected edge a - b (a repeated edge is only kept once).
+ */
+void GraphBuilder::addEdge(std::string_view a, std::string_view b) {
+    VertexId from = intern(a);
+    addEdge(from, intern(b));
+}
+
+void GraphBuilder::addEdge(const VertexId& a, const VertexId& b) {
+    edges_.push_back(std::minmax(a, b));
+}
+
+/**
+ * @brief Returns the number of edges added so far, including repeats.
+ */
+size_t GraphBuilder::pendingEdges() const {
+    return edges_.size();
+}
+
+/**
+ * @brief Sorts a vector by sorting `threads` chunks of it at once,
+ * then merging neighbouring chunks pairwise until one is left.
+ */
+template <class T>
+void parallel_sort(std::vector<T>& values, const size_t& threads) {
+    size_t chunks = std::max<size_t>(1, std::min(threads, values.size() / 4096));
+    std::vector<size_t> bounds;
+    for (size_t i = 0; i <= chunks; ++i) {
+        bounds.push_back(values.size() * i / chunks);
+    }
+
+    run_tasks(chunks, threads, [&] (size_t i) {
+        std::sort(values.begin() + bounds[i], values.begin() + bounds[i + 1]);
+    });
+    for (size_t width = 1; width < chunks; width *= 2) {
+        size_t merges = (chunks + 2 * width - 1) / (2 * width);
+        run_tasks(merges, threads, [&] (size_t m) {
+            size_t first = 2 * width * m, middle = std::min(first + width, chunks), last = std::min(first + 2 * width, chunks);
+            std::inplace_merge(values.begin() + bounds[first], values.begin() + bounds[middle], values.begin() + bounds[last]);
+        });
+    }
+}
+
+/**
+ * @brief Moves every name & edge of other builders into this one, as if they had been
+ * added here in order.
+ *
+ * @param others The builders to merge, e.g. one per file or per chunk of a file
+ * @param threads The maximum number of threads renumbering edges at once
+ * @post Every builder in `others` is left empty.
+ */
+void GraphBuilder::merge(std::vector<GraphBuilder>& others, const size_t& threads) {
+    // renumbering[b][i] is this builder's id for name i of others[b]
+    std::vector<std::vector<VertexId>> renumbering(others.size());
+    std::vector<size_t> starts(others.size());
+    size_t total = edges_.size();
+    for (size_t b = 0; b < others.size(); ++b) {
+        for (const std::string& name : others[b].names_) {
+            renumbering[b].push_back(intern(name));
+        }
+        starts[b] = total;
+        total += others[b].edges_.size();
+    }
+
+    edges_.resize(total);
+    run_tasks(others.size(), threads, [&] (size_t b) {
+        auto out = edges_.begin() + starts[b];
+        for (const auto& edge : others[b].edges_) {
+            *out++ = std::minmax(renumbering[b][edge.first], renumbering[b][edge.second]);
+        }
+        others[b] = GraphBuilder();
+    });
+}
+
+/**
+ * @brief Builds the graph of every edge added, in O(V + E log E).
+ *
+ * 1) Sorts & deduplicates the edges
+ * 2) Counts every vertex's degree, & turns the counts into offsets with a prefix sum
+ * 3) Scatters both ends of every edge into place; since the edges are sorted,
+ *    every neighbourhood comes out sorted too
+ *
+ * @param threads The number of threads sorting the edges
+ * @post The builder is left empty, & can be reused.
+ */
+CompactGraph GraphBuilder::build(const size_t& threads) {
+    parallel_sort(edges_, threads);
+    edges_.erase(std::unique(edges_.begin(), edges_.end()), edges_.end());
+
+    CompactGraph graph;
+    graph.edges_ = edges_.size();
+    graph.offsets_.assign(names_.size() + 1, 0);
+    for (const auto& edge : edges_) {
+        graph.offsets_[edge.first + 1]++;
+        if (edge.second != edge.first) {
+            graph.offsets_[edge.second + 1]++;
+        }
+    }
+    for (size_t v = 0; v < names_.size(); ++v) {
+        graph.offsets_[v + 1] += graph.offsets_[v];
+    }
+
+    // scatter the higher ends first, so lower neighbours land before higher ones
+    graph.adjacency_.resize(graph.offsets_.back());
+    std::vector<size_t> next(graph.offsets_.begin(), graph.offsets_.end() - 1);
+    for (const auto& edge : edges_) {
+        if (edge.second != edge.first) {
+            graph.adjacency_[next[edge.second]++] = edge.first;
+        }
+    }
+    for (const auto& edge : edges_) {
+        graph.adjacency_[next[edge.first]++] = edge.second;
+    }
+
+    graph.names_ = std::move(names_);
+    graph.ids_ = std::move(ids_);
+    names_.clear();
+    ids_.clear();
+    std::vector<std::pair<VertexId, VertexId>>().swap(edges_); // release the buffer, it can be large
+    return graph;
+}
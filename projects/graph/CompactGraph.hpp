@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using VertexId = std::uint32_t;
+
+/**
+ * @brief A read-only undirected graph over interned vertex names,
+ * in compressed sparse row (CSR) form.
+ *
+ * Every vertex name is stored once & given a dense VertexId, from 0 to vertexCount() - 1.
+ * The neighbours of vertex v are the contiguous slice [offsets_[v], offsets_[v+1]) of one
+ * adjacency array, sorted & without duplicates, so an edge costs two 4 byte ids
+ * instead of two hashed string nodes, & walking a neighbourhood reads consecutive memory.
+ *
+ * Build one with a GraphBuilder (or VertexCover::readCompactFromFile()).
+ *
+ * EXAMPLE: the edges JFK - LGA & JFK - KIX give
+ *   names_     = { "JFK", "LGA", "KIX" }
+ *   offsets_   = { 0, 2, 3, 4 }
+ *   adjacency_ = { 1, 2,   0,   0 }
+ */
+class CompactGraph {
+public:
+    /**
+     * @brief Constructs an empty graph.
+     */
+    CompactGraph();
+
+    /**
+     * @brief Returns the number of vertices.
+     */
+    size_t vertexCount() const;
+
+    /**
+     * @brief Returns the number of (undirected) edges, each counted once.
+     */
+    size_t edgeCount() const;
+
+    /**
+     * @brief Returns the name of a vertex.
+     */
+    const std::string& name(const VertexId& v) const;
+
+    /**
+     * @brief Looks up the id of a vertex by name.
+     * @throws (std::out_of_range) If there is no vertex of that name.
+     */
+    VertexId id(const std::string& name) const;
+
+    /**
+     * @brief Checks if the graph has a vertex of that name.
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Returns the number of neighbours of a vertex (a self-loop counts once).
+     */
+    size_t degree(const VertexId& v) const;
+
+    /**
+     * @brief Returns a pointer to the first neighbour of a vertex, in ascending id order.
+     */
+    const VertexId* neighborsBegin(const VertexId& v) const;
+
+    /**
+     * @brief Returns a pointer to one past the last neighbour of a vertex.
+     */
+    const VertexId* neighborsEnd(const VertexId& v) const;
+
+private:
+    std::vector<std::string> names_; // VertexId -> name
+    std::unordered_map<std::string, VertexId> ids_; // name -> VertexId
+    std::vector<size_t> offsets_; // vertexCount() + 1 offsets into adjacency_
+    std::vector<VertexId> adjacency_; // every vertex's neighbours, back to back
+    size_t edges_;
+
+    friend class GraphBuilder;
+};
+
+/**
+ * @brief Collects named edges & builds a CompactGraph from them.
+ *
+ * Names are interned as they arrive, & edges are buffered as pairs of ids, so adding an edge
+ * never allocates a set node. build() sorts & deduplicates the buffer once, then lays out
+ * the CSR arrays in two passes.
+ */
+class GraphBuilder {
+public:
+    /**
+     * @brief Returns the id of a vertex name, giving it the next id if it's new.
+     */
+    VertexId intern(std::string_view name);
+
+    /**
+     * @brief Adds the undirected edge a - b (a repeated edge is only kept once).
+     */
+    void addEdge(std::string_view a, std::string_view b);
+    void addEdge(const VertexId& a, const VertexId& b);
+
+    /**
+     * @brief Returns the number of edges added so far, including repeats.
+     */
+    size_t pendingEdges() const;
+
+    /**
+     * @brief Moves every name & edge of other builders into this one, as if they had been
+     * added here in order (so vertex ids are given out by first appearance, as they would be
+     * reading the sources one after another).
+     *
+     * Names are interned one builder at a time, since there are few of them; then every
+     * builder's edges are renumbered into this one's buffer in parallel.
+     *
+     * @param others The builders to merge, e.g. one per file or per chunk of a file
+     * @param threads The maximum number of threads renumbering edges at once
+     * @post Every builder in `others` is left empty.
+     */
+    void merge(std::vector<GraphBuilder>& others, const size_t& threads = 1);
+
+    /**
+     * @brief Builds the graph of every edge added, in O(V + E log E).
+     * @param threads The number of threads sorting the edges; chunks are sorted
+     *      in parallel, then merged pairwise, also in parallel
+     * @post The builder is left empty, & can be reused.
+     */
+    CompactGraph build(const size_t& threads = 1);
+
+private:
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, VertexId> ids_;
+    std::vector<std::pair<VertexId, VertexId>> edges_; // (lower id, higher id)
+    std::string key_; // reused lookup key, so finding a known name never allocates
+};
+
+/**
+ * @brief Runs task(0), ..., task(count - 1) on up to `threads` threads (including the calling one),
+ * where thread w runs tasks w, w + threads, w + 2 * threads, ...
+ */
+template <class Task>
+void run_tasks(const size_t& count, const size_t& threads, Task task) {
+    size_t workers = std::max<size_t>(1, std::min(threads, count));
+    auto work = [&] (size_t w) {
+        for (size_t i = w; i < count; i += workers) {
+            task(i);
+        }
+    };
+    std::vector<std::future<void>> running;
+    for (size_t w = 1; w < workers; ++w) {
+        running.push_back(std::async(std::launch::async, work, w));
+    }
+    work(0);
+    for (auto& worker : running) {
+        worker.get();
+    }
+}
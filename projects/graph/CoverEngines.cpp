@@ -0,0 +1,352 @@
+#include "CoverEngines.hpp"
+
+#include <atomic>
+
+CoverResult::CoverResult(const std::unordered_set<Vertex>& cover, const size_t& lower_bound, const bool& optimal, double elapsed)
+    : cover_(cover), lower_bound_(lower_bound), optimal_(optimal), elapsed_(elapsed) {}
+
+/**
+ * @brief Returns the number of vertices in the cover.
+ */
+size_t CoverResult::size() const {
+    return cover_.size();
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const VertexId NONE = ~VertexId(0);
+
+double elapsed_ms(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Gathers the names of the vertices flagged in `in_cover`.
+ */
+std::unordered_set<Vertex> names_of(const CompactGraph& g, const std::vector<char>& in_cover) {
+    std::unordered_set<Vertex> cover;
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        if (in_cover[v]) {
+            cover.insert(g.name(v));
+        }
+    }
+    return cover;
+}
+
+/**
+ * @brief The weight of the edge u - v: the same from both ends, & distinct for every edge,
+ * since the splitmix64 finalizer is a bijection on the (lower, higher) id pair.
+ */
+std::uint64_t edge_weight(const VertexId& u, const VertexId& v) {
+    std::uint64_t key = (std::uint64_t(std::min(u, v)) << 32) | std::max(u, v);
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
+
+/**
+ * @brief Matches greedily within one list of vertices, flagging both ends of every matched
+ * edge in `matched` (a self-loop matches its vertex alone).
+ * @return The number of matched edges.
+ */
+size_t greedy_matching(const CompactGraph& g, const VertexId* first, const VertexId* last, std::vector<char>& matched) {
+    size_t edges = 0;
+    for (; first != last; ++first) {
+        VertexId v = *first;
+        if (matched[v]) {
+            continue;
+        }
+        for (const VertexId* n = g.neighborsBegin(v); n != g.neighborsEnd(v); ++n) {
+            if (!matched[*n]) {
+                matched[v] = matched[*n] = 1;
+                edges++;
+                break;
+            }
+        }
+    }
+    return edges;
+}
+
+/**
+ * @brief Finds a minimum vertex cover of a graph of at most 64 vertices by branch & bound,
+ * on bitmasks of vertices.
+ */
+class ExactCover {
+public:
+    /**
+     * @param adjacency Every vertex's neighbours as a bitmask, without self-loops.
+     */
+    explicit ExactCover(const std::vector<std::uint64_t>& adjacency) : adjacency_(adjacency), best_(0), best_size_(0) {}
+
+    /**
+     * @brief Covers the edges among `alive`, given a partial cover already taken.
+     * @return The minimum cover, including `cover`.
+     */
+    std::uint64_t solve(const std::uint64_t& alive, const std::uint64_t& cover) {
+        best_ = alive | cover; // every vertex is a cover
+        best_size_ = __builtin_popcountll(best_);
+        branch(alive, cover, __builtin_popcountll(cover));
+        return best_;
+    }
+
+private:
+    std::vector<std::uint64_t> adjacency_;
+    std::uint64_t best_;
+    int best_size_;
+
+    static std::uint64_t bit(const int& v) {
+        return std::uint64_t(1) << v;
+    }
+
+    /**
+     * @brief Returns the size of a greedy maximal matching among `alive`,
+     * which no cover of them can be smaller than.
+     */
+    int matchingBound(std::uint64_t alive) const {
+        int edges = 0;
+        while (alive) {
+            int v = __builtin_ctzll(alive);
+            alive &= ~bit(v);
+            std::uint64_t neighbours = adjacency_[v] & alive;
+            if (neighbours) {
+                alive &= ~bit(__builtin_ctzll(neighbours));
+                edges++;
+            }
+        }
+        return edges;
+    }
+
+    void branch(std::uint64_t alive, std::uint64_t cover, int size) {
+        // kernelise: drop isolated vertices, & cover the neighbour of every degree 1 vertex
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (std::uint64_t rest = alive; rest; rest &= rest - 1) {
+                int v = __builtin_ctzll(rest);
+                if (!(alive & bit(v))) {
+                    continue;
+                }
+                std::uint64_t neighbours = adjacency_[v] & alive;
+                if (!neighbours) {
+                    alive &= ~bit(v);
+                    changed = true;
+                } else if (!(neighbours & (neighbours - 1))) {
+                    cover |= neighbours;
+                    size++;
+                    alive &= ~(neighbours | bit(v));
+                    changed = true;
+                }
+            }
+        }
+
+        if (alive == 0) {
+            if (size < best_size_) {
+                best_ = cover;
+                best_size_ = size;
+            }
+            return;
+        }
+        if (size + matchingBound(alive) >= best_size_) {
+            return;
+        }
+
+        // branch on a maximum degree vertex: it's in the cover, or all its neighbours are
+        int v = 0, degree = -1;
+        for (std::uint64_t rest = alive; rest; rest &= rest - 1) {
+            int u = __builtin_ctzll(rest);
+            int d = __builtin_popcountll(adjacency_[u] & alive);
+            if (d > degree) {
+                v = u;
+                degree = d;
+            }
+        }
+        std::uint64_t neighbours = adjacency_[v] & alive;
+        branch(alive & ~bit(v), cover | bit(v), size + 1);
+        branch(alive & ~(neighbours | bit(v)), cover | neighbours, size + degree);
+    }
+};
+
+}
+
+/**
+ * @brief Runs cover_graph_bucketed() & times it, for comparison with the other engines.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (CoverResult) The greedy cover, with no lower bound.
+ */
+CoverResult VertexCover::cover_graph_greedy(const CompactGraph& g) {
+    auto start = Clock::now();
+    std::unordered_set<Vertex> cover = cover_graph_bucketed(g);
+    return CoverResult(cover, 0, false, elapsed_ms(start));
+}
+
+/**
+ * @brief Generates a vertex cover from a maximal matching: both ends of every matched edge.
+ *
+ * Each round, every active vertex (one that had an unmatched neighbour last round) picks
+ * its lightest edge to an unmatched neighbour into `choice`, then every vertex whose pick
+ * is returned, matches. Within a phase, a vertex's entries are only written by whichever
+ * thread has it, so the threads share no writes.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @param threads (const. size_t reference) The number of threads to run each round on.
+ * @return (CoverResult) The cover, with the matching's size as its lower bound.
+ */
+CoverResult VertexCover::cover_graph_matching(const CompactGraph& g, const size_t& threads) {
+    auto start = Clock::now();
+
+    std::vector<char> matched(g.vertexCount(), 0);
+    std::vector<VertexId> choice(g.vertexCount(), NONE);
+    std::vector<VertexId> active;
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        if (g.degree(v) > 0) {
+            active.push_back(v);
+        }
+    }
+
+    size_t matching = 0;
+    std::vector<char> newly(g.vertexCount(), 0);
+    while (!active.empty()) {
+        size_t chunks = std::max<size_t>(1, std::min(threads, active.size() / 1024));
+        auto chunk = [&] (size_t i) {
+            return std::make_pair(active.data() + active.size() * i / chunks, active.data() + active.size() * (i + 1) / chunks);
+        };
+
+        // 1) pick
+        run_tasks(chunks, threads, [&] (size_t i) {
+            for (auto range = chunk(i); range.first != range.second; ++range.first) {
+                VertexId v = *range.first;
+                VertexId best = NONE;
+                std::uint64_t lightest = 0;
+                for (const VertexId* n = g.neighborsBegin(v); n != g.neighborsEnd(v); ++n) {
+                    std::uint64_t weight = edge_weight(v, *n);
+                    if (!matched[*n] && (best == NONE || weight < lightest)) {
+                        best = *n;
+                        lightest = weight;
+                    }
+                }
+                choice[v] = best;
+            }
+        });
+
+        // 2) match mutual picks, counting each matched edge from its lower end
+        std::vector<size_t> counts(chunks, 0);
+        run_tasks(chunks, threads, [&] (size_t i) {
+            for (auto range = chunk(i); range.first != range.second; ++range.first) {
+                VertexId v = *range.first;
+                newly[v] = choice[v] != NONE && choice[choice[v]] == v;
+                counts[i] += newly[v] && v <= choice[v];
+            }
+        });
+
+        // 3) keep the vertices which may still match
+        size_t kept = 0;
+        for (VertexId v : active) {
+            if (newly[v]) {
+                matched[v] = 1;
+            } else if (choice[v] != NONE) {
+                active[kept++] = v;
+            }
+        }
+        active.resize(kept);
+        for (const size_t& count : counts) {
+            matching += count;
+        }
+    }
+
+    std::unordered_set<Vertex> cover = names_of(g, matched);
+    return CoverResult(cover, matching, false, elapsed_ms(start));
+}
+
+/**
+ * @brief Splits a graph into its connected components & covers them concurrently:
+ * exactly, by branch & bound, if they have at most `exact_limit` vertices, or by
+ * maximal matching otherwise.
+ *
+ * Components are found with a breadth-first search, & handed out largest first.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @param threads (const. size_t reference) The number of threads covering components at once.
+ * @param exact_limit (const. size_t reference) The largest component to solve exactly, at most 64.
+ * @return (CoverResult) The cover, which is optimal_ if every component was solved exactly.
+ */
+CoverResult VertexCover::cover_graph_exact(const CompactGraph& g, const size_t& threads, const size_t& exact_limit) {
+    auto start = Clock::now();
+    const size_t limit = std::min<size_t>(exact_limit, 64);
+
+    // lay the components out back to back in `order`, component c being [bounds[c], bounds[c+1])
+    std::vector<VertexId> order;
+    std::vector<size_t> bounds;
+    std::vector<char> seen(g.vertexCount(), 0);
+    order.reserve(g.vertexCount());
+    for (VertexId root = 0; root < g.vertexCount(); ++root) {
+        if (seen[root] || g.degree(root) == 0) {
+            continue;
+        }
+        bounds.push_back(order.size());
+        seen[root] = 1;
+        order.push_back(root);
+        for (size_t i = bounds.back(); i < order.size(); ++i) {
+            for (const VertexId* n = g.neighborsBegin(order[i]); n != g.neighborsEnd(order[i]); ++n) {
+                if (!seen[*n]) {
+                    seen[*n] = 1;
+                    order.push_back(*n);
+                }
+            }
+        }
+    }
+    bounds.push_back(order.size());
+
+    std::vector<size_t> components(bounds.size() - 1);
+    for (size_t c = 0; c < components.size(); ++c) {
+        components[c] = c;
+    }
+    std::sort(components.begin(), components.end(), [&] (const size_t& a, const size_t& b) {
+        return bounds[a + 1] - bounds[a] > bounds[b + 1] - bounds[b];
+    });
+
+    // components are disjoint, so every task writes its own vertices' entries only
+    std::vector<char> in_cover(g.vertexCount(), 0);
+    std::vector<int> local(g.vertexCount(), -1);
+    std::atomic<size_t> lower_bound(0);
+    std::atomic<bool> optimal(true);
+
+    run_tasks(components.size(), threads, [&] (size_t i) {
+        const VertexId* first = order.data() + bounds[components[i]];
+        const VertexId* last = order.data() + bounds[components[i] + 1];
+        size_t count = last - first;
+
+        if (count > limit) {
+            lower_bound += greedy_matching(g, first, last, in_cover);
+            optimal = false;
+            return;
+        }
+
+        for (size_t v = 0; v < count; ++v) {
+            local[first[v]] = v;
+        }
+        std::vector<std::uint64_t> adjacency(count, 0);
+        std::uint64_t loops = 0; // vertices with a self-loop, which must be in the cover
+        for (size_t v = 0; v < count; ++v) {
+            for (const VertexId* n = g.neighborsBegin(first[v]); n != g.neighborsEnd(first[v]); ++n) {
+                if (*n == first[v]) {
+                    loops |= std::uint64_t(1) << v;
+                } else {
+                    adjacency[v] |= std::uint64_t(1) << local[*n];
+                }
+            }
+        }
+
+        std::uint64_t everyone = (count == 64) ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+        std::uint64_t cover = ExactCover(adjacency).solve(everyone & ~loops, loops);
+        lower_bound += __builtin_popcountll(cover);
+        for (size_t v = 0; v < count; ++v) {
+            in_cover[first[v]] = (cover >> v) & 1;
+        }
+    });
+
+    std::unordered_set<Vertex> cover = names_of(g, in_cover);
+    return CoverResult(cover, lower_bound, optimal, elapsed_ms(start));
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CompactGraph.hpp"
+#include "Graph.hpp"
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief The outcome of a vertex cover engine, so engines can be compared on the same graph.
+ */
+struct CoverResult {
+    /**
+     * @brief The vertices of the cover.
+     */
+    std::unordered_set<Vertex> cover_;
+
+    /**
+     * @brief A proven lower bound on the size of a minimum vertex cover of the graph
+     * (e.g. the size of a matching, since every matched edge needs its own cover vertex),
+     * or 0 if the engine doesn't compute one. cover_.size() / lower_bound_ bounds how far
+     * from optimal the cover can be.
+     */
+    size_t lower_bound_;
+
+    /**
+     * @brief Whether the engine proved cover_ is a minimum vertex cover.
+     */
+    bool optimal_;
+
+    /**
+     * @brief The time taken to compute the cover, in ms.
+     */
+    double elapsed_;
+
+    CoverResult(const std::unordered_set<Vertex>& cover = {}, const size_t& lower_bound = 0, const bool& optimal = false, double elapsed = 0);
+
+    /**
+     * @brief Returns the number of vertices in the cover.
+     */
+    size_t size() const;
+};
+
+namespace VertexCover {
+
+// Connected components of up to this many vertices are solved exactly by cover_graph_exact()
+const size_t EXACT_LIMIT = 40;
+
+/**
+ * @brief Runs cover_graph_bucketed() & times it, for comparison with the other engines.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (CoverResult) The greedy cover, with no lower bound.
+ */
+CoverResult cover_graph_greedy(const CompactGraph& g);
+
+/**
+ * @brief Generates a vertex cover from a maximal matching: both ends of every matched edge.
+ *
+ * Since no two matched edges share a vertex, a minimum cover needs at least one vertex per
+ * matched edge, so the cover is at most twice the minimum (a 2-approximation).
+ *
+ * The matching is built in rounds over the CSR graph, every round in parallel:
+ * 1) Every unmatched vertex picks its lightest edge to an unmatched neighbour, where an
+ *    edge's weight is a hash of its two ids (the same from both ends, & distinct per edge)
+ * 2) Every edge picked from both ends is matched
+ * The globally lightest remaining edge is always picked from both ends, so every round makes
+ * progress; with hashed weights, only O(log V) rounds are expected. Vertices left without
+ * unmatched neighbours drop out of later rounds. The result doesn't depend on `threads`.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @param threads (const. size_t reference) The number of threads to run each round on.
+ * @return (CoverResult) The cover, with the matching's size as its lower bound.
+ */
+CoverResult cover_graph_matching(const CompactGraph& g, const size_t& threads = std::max(1u, std::thread::hardware_concurrency()));
+
+/**
+ * @brief Splits a graph into its connected components & covers them concurrently:
+ * exactly, by branch & bound, if they have at most `exact_limit` vertices, or by
+ * maximal matching otherwise.
+ *
+ * An exact component is first kernelised (a vertex with a self-loop must be in the cover;
+ * for a degree 1 vertex, its neighbour may as well be), then branches on a maximum degree
+ * vertex v: either v is in the cover, or all of its neighbours are. A branch is cut when
+ * its cover so far plus a greedy matching of what's left can't beat the best found.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @param threads (const. size_t reference) The number of threads covering components at once.
+ * @param exact_limit (const. size_t reference) The largest component to solve exactly, at most 64.
+ * @return (CoverResult) The cover, which is optimal_ if every component was solved exactly.
+ *      Its lower bound sums the exact components' sizes & the other components' matchings.
+ */
+CoverResult cover_graph_exact(const CompactGraph& g, const size_t& threads = std::max(1u, std::thread::hardware_concurrency()),
+    const size_t& exact_limit = EXACT_LIMIT);
+}
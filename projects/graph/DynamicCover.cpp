@@ -0,0 +1,185 @@
+#include "DynamicCover.hpp"
+
+/**
+ * @brief Returns true if the cover didn't change.
+ */
+bool CoverChange::empty() const {
+    return added_.empty() && removed_.empty();
+}
+
+/**
+ * @brief Constructs an empty network, with an empty cover.
+ */
+DynamicCover::DynamicCover() : cover_size_(0), edges_(0) {}
+
+/**
+ * @brief Starts from the routes of a graph & a greedy cover of them (cover_graph_bucketed()),
+ * less any vertex of it whose neighbours are all covered.
+ *
+ * One pass of pruning is enough: dropping a vertex only uncovers it, so no vertex that was
+ * needed before can become redundant.
+ */
+DynamicCover::DynamicCover(const CompactGraph& g) : cover_size_(0), edges_(g.edgeCount()) {
+    names_.reserve(g.vertexCount());
+    adjacency_.resize(g.vertexCount());
+    in_cover_.assign(g.vertexCount(), 0);
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        names_.push_back(g.name(v));
+        ids_.emplace(g.name(v), v);
+        adjacency_[v].insert(g.neighborsBegin(v), g.neighborsEnd(v));
+    }
+    for (const Vertex& v : VertexCover::cover_graph_bucketed(g)) {
+        in_cover_[ids_.at(v)] = 1;
+        cover_size_++;
+    }
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        if (in_cover_[v] && redundant(v)) {
+            in_cover_[v] = 0;
+            cover_size_--;
+        }
+    }
+}
+
+/**
+ * @brief Returns the id of an airport, giving it the next id if it's new.
+ */
+VertexId DynamicCover::intern(const Vertex& name) {
+    auto inserted = ids_.emplace(name, names_.size());
+    if (inserted.second) {
+        names_.push_back(name);
+        adjacency_.emplace_back();
+        in_cover_.push_back(0);
+    }
+    return inserted.first->second;
+}
+
+/**
+ * @brief Checks if a covered vertex can leave the cover: every neighbour is covered,
+ * & it has no self-loop.
+ */
+bool DynamicCover::redundant(const VertexId& v) const {
+    for (const VertexId& n : adjacency_[v]) {
+        if (n == v || !in_cover_[n]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DynamicCover::add(const VertexId& v, CoverChange& change) {
+    in_cover_[v] = 1;
+    cover_size_++;
+    change.added_.push_back(names_[v]);
+}
+
+void DynamicCover::drop(const VertexId& v, CoverChange& change) {
+    in_cover_[v] = 0;
+    cover_size_--;
+    change.removed_.push_back(names_[v]);
+}
+
+/**
+ * @brief Adds the route a - b, covering it if neither end is covered yet.
+ *
+ * The end of higher degree is covered, since it's likelier to cover future routes too.
+ * Its covered neighbours may then be redundant, so each one is checked, & dropped if it is.
+ *
+ * @return The change to the cover, which is empty if the route was already there.
+ */
+CoverChange DynamicCover::addEdge(const Vertex& a, const Vertex& b) {
+    CoverChange change;
+    VertexId u = intern(a), v = intern(b);
+    if (!adjacency_[u].insert(v).second) {
+        return change;
+    }
+    adjacency_[v].insert(u);
+    edges_++;
+
+    if (in_cover_[u] || in_cover_[v]) {
+        return change;
+    }
+    VertexId covered = (adjacency_[v].size() > adjacency_[u].size()) ? v : u;
+    add(covered, change);
+
+    for (const VertexId& n : adjacency_[covered]) {
+        if (n != covered && in_cover_[n] && redundant(n)) {
+            drop(n, change);
+        }
+    }
+    return change;
+}
+
+/**
+ * @brief Removes the route a - b, dropping either end from the cover if it's no longer needed.
+ * @return The change to the cover, which is empty if there was no such route.
+ */
+CoverChange DynamicCover::removeEdge(const Vertex& a, const Vertex& b) {
+    CoverChange change;
+    auto first = ids_.find(a), second = ids_.find(b);
+    if (first == ids_.end() || second == ids_.end() || adjacency_[first->second].erase(second->second) == 0) {
+        return change;
+    }
+    VertexId u = first->second, v = second->second;
+    adjacency_[v].erase(u);
+    edges_--;
+
+    // keep at most one end, if both are covered & only needed each other
+    if (in_cover_[u] && redundant(u)) {
+        drop(u, change);
+    }
+    if (in_cover_[v] && redundant(v)) {
+        drop(v, change);
+    }
+    return change;
+}
+
+/**
+ * @brief Checks if the route a - b is in the network.
+ */
+bool DynamicCover::hasEdge(const Vertex& a, const Vertex& b) const {
+    auto first = ids_.find(a), second = ids_.find(b);
+    return first != ids_.end() && second != ids_.end() && adjacency_[first->second].count(second->second) > 0;
+}
+
+/**
+ * @brief Checks if an airport is in the cover.
+ */
+bool DynamicCover::inCover(const Vertex& v) const {
+    auto itr = ids_.find(v);
+    return itr != ids_.end() && in_cover_[itr->second];
+}
+
+/**
+ * @brief Returns the number of routes from an airport, or 0 if it's unknown.
+ */
+size_t DynamicCover::degree(const Vertex& v) const {
+    auto itr = ids_.find(v);
+    return itr == ids_.end() ? 0 : adjacency_[itr->second].size();
+}
+
+/**
+ * @brief Returns the number of airports in the cover.
+ */
+size_t DynamicCover::size() const {
+    return cover_size_;
+}
+
+/**
+ * @brief Returns the number of routes in the network.
+ */
+size_t DynamicCover::edgeCount() const {
+    return edges_;
+}
+
+/**
+ * @brief Returns a copy of the current cover.
+ */
+std::unordered_set<Vertex> DynamicCover::cover() const {
+    std::unordered_set<Vertex> cover;
+    for (VertexId v = 0; v < names_.size(); ++v) {
+        if (in_cover_[v]) {
+            cover.insert(names_[v]);
+        }
+    }
+    return cover;
+}
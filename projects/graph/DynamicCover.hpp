@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CompactGraph.hpp"
+#include "Graph.hpp"
+
+/**
+ * @brief The vertices an update added to & removed from a DynamicCover.
+ */
+struct CoverChange {
+    std::vector<Vertex> added_;
+    std::vector<Vertex> removed_;
+
+    /**
+     * @brief Returns true if the cover didn't change.
+     */
+    bool empty() const;
+};
+
+/**
+ * @brief A vertex cover of a changing route network, repaired locally as routes are
+ * added & removed instead of being recomputed.
+ *
+ * The cover is kept valid, & minimal around every change:
+ * 1) Adding an uncovered edge covers its endpoint of higher degree, then drops any covered
+ *    neighbour of it whose neighbours are now all covered (it's no longer needed)
+ * 2) Removing an edge drops either endpoint whose remaining neighbours are all covered
+ * So an update costs O(deg) hash operations for the endpoints' neighbourhoods,
+ * plus their covered neighbours' degrees after an addition. The cover can drift from what
+ * cover_graph() would find from scratch; it's never worse than covering every vertex, &
+ * never holds a vertex whose every neighbour is covered, unless it has a self-loop.
+ *
+ * EXAMPLE:
+ *   DynamicCover cover;
+ *   cover.addEdge("JFK", "LGA")  -> added { "JFK" }
+ *   cover.addEdge("JFK", "KIX")  -> nothing, JFK covers it
+ *   cover.addEdge("LGA", "KIX")  -> added { "LGA" }
+ *   cover.removeEdge("JFK", "KIX") -> removed { "JFK" }, LGA covers JFK - LGA now
+ */
+class DynamicCover {
+public:
+    /**
+     * @brief Constructs an empty network, with an empty cover.
+     */
+    DynamicCover();
+
+    /**
+     * @brief Starts from the routes of a graph & a greedy cover of them (cover_graph_bucketed()),
+     * less any vertex of it whose neighbours are all covered.
+     */
+    explicit DynamicCover(const CompactGraph& g);
+
+    /**
+     * @brief Adds the route a - b, covering it if neither end is covered yet.
+     * @return The change to the cover, which is empty if the route was already there.
+     */
+    CoverChange addEdge(const Vertex& a, const Vertex& b);
+
+    /**
+     * @brief Removes the route a - b, dropping either end from the cover if it's no longer needed.
+     * @return The change to the cover, which is empty if there was no such route.
+     */
+    CoverChange removeEdge(const Vertex& a, const Vertex& b);
+
+    /**
+     * @brief Checks if the route a - b is in the network.
+     */
+    bool hasEdge(const Vertex& a, const Vertex& b) const;
+
+    /**
+     * @brief Checks if an airport is in the cover.
+     */
+    bool inCover(const Vertex& v) const;
+
+    /**
+     * @brief Returns the number of routes from an airport, or 0 if it's unknown.
+     */
+    size_t degree(const Vertex& v) const;
+
+    /**
+     * @brief Returns the number of airports in the cover.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of routes in the network.
+     */
+    size_t edgeCount() const;
+
+    /**
+     * @brief Returns a copy of the current cover.
+     */
+    std::unordered_set<Vertex> cover() const;
+
+private:
+    std::vector<Vertex> names_; // VertexId -> name
+    std::unordered_map<Vertex, VertexId> ids_; // name -> VertexId
+    std::vector<std::unordered_set<VertexId>> adjacency_; // kept up to date with every route change
+    std::vector<char> in_cover_;
+    size_t cover_size_;
+    size_t edges_;
+
+    /**
+     * @brief Returns the id of an airport, giving it the next id if it's new.
+     */
+    VertexId intern(const Vertex& name);
+
+    /**
+     * @brief Checks if a covered vertex can leave the cover: every neighbour is covered,
+     * & it has no self-loop.
+     */
+    bool redundant(const VertexId& v) const;
+
+    void add(const VertexId& v, CoverChange& change);
+    void drop(const VertexId& v, CoverChange& change);
+};
@@ -1,5 +1,15 @@
 #include "Graph.hpp"
 
+#include <atomic>
+#include <cstring> // memchr
+#include <exception>
+#include <future>
+#include <memory>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 /**
  * Prints graph for debugging purposes.
  */
@@ -18,17 +28,166 @@ void VertexCover::displayGraphHidden(Graph g) {
 
 /**
  * @brief Helper function to return three letter airport code from segemented string.
+ *
+ * Returns a view into `input` rather than a copy: the code starts after the first "- "
+ * & runs up to the next space (or the end).
  */
-std::string find_location(std::string input) {
+std::string_view find_location(std::string_view input) {
     auto start = input.find("- ");
-    input = input.substr(start+2);
-    auto end = input.find(" ");
-    if (end != std::string::npos) {
+    start = (start == std::string_view::npos) ? 1 : start + 2; // where substr(npos + 2) would start
+    if (start > input.size()) {
+        throw std::out_of_range("No airport code in: " + std::string(input));
+    }
+    input.remove_prefix(start);
+    auto end = input.find(' ');
+    if (end != std::string_view::npos) {
         input = input.substr(0,end);
     }
     return input;
 }
 
+/**
+ * @brief A whole file, memory-mapped read-only for as long as this lives.
+ */
+struct MappedFile {
+    const char* data_;
+    size_t length_;
+
+    /**
+     * @throws (std::runtime_error) If the file cannot be opened.
+     */
+    explicit MappedFile(const std::string& filename) : data_(nullptr), length_(0) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        struct stat status;
+        if (fd < 0 || ::fstat(fd, &status) != 0) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw std::runtime_error("Cannot open file.");
+        }
+        length_ = status.st_size;
+        if (length_ > 0) {
+            void* data = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot open file.");
+            }
+            ::madvise(data, length_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(data);
+        }
+        ::close(fd); // the mapping keeps the file open
+    }
+
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), length_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+/**
+ * @brief Helper function to read every edge in the lines of [cursor, end), handing each
+ * one's departure & destination codes to `add_edge` as views into the text.
+ *
+ * Lines are found with memchr & split with std::string_view, so nothing is copied
+ * or allocated per line. Like the original std::getline loop, reading stops at the
+ * first line without a "|".
+ *
+ * @return The start of the line reading stopped at, or nullptr if it reached `end`.
+ */
+template <class AddEdge>
+const char* scan_edges(const char* cursor, const char* end, AddEdge add_edge) {
+    // goes through text, line by line
+    // ex. Departure (15: 43) - SRB | Destination  (03: 36) - WIE
+    while (cursor < end) {
+        const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        const char* line_end = (newline != nullptr) ? newline : end;
+        std::string_view line(cursor, line_end - cursor);
+
+        auto seperater = line.find('|');
+
+        if (seperater == std::string_view::npos) {
+            return cursor;
+        }
+
+        add_edge(find_location(line.substr(0,seperater)), find_location(line.substr(seperater+1)));
+        cursor = line_end + 1;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Helper function to read every edge of a flight table, handing each one's
+ * departure & destination codes to `add_edge` as views into the file.
+ *
+ * The file is memory-mapped & scanned in place by scan_edges().
+ *
+ * @throws (std::runtime_error) If the file cannot be opened.
+ */
+template <class AddEdge>
+void read_edges(const std::string& filename, AddEdge add_edge) {
+    MappedFile file(filename);
+    scan_edges(file.data_, file.data_ + file.length_, add_edge);
+}
+
+/**
+ * @brief Helper function to parse each of `count` pieces of text into its own GraphBuilder
+ * on up to `threads` threads, then merge them into one CompactGraph, in order.
+ *
+ * @param text Called as text(i) on a worker thread, returning {begin, end} of piece i
+ * @param stop_at_break If true, a line without a "|" ends the input as a whole,
+ *      so every piece after the one it's in is dropped; otherwise it only ends its own piece
+ */
+template <class Text>
+CompactGraph build_in_parallel(const size_t& count, const size_t& threads, Text text, const bool& stop_at_break) {
+    std::vector<GraphBuilder> locals(count);
+    std::vector<char> stopped(count); // not vector<bool>, whose elements share words across threads
+    std::vector<std::exception_ptr> errors(count);
+
+    std::atomic<size_t> next(0); // the next piece to claim
+    auto work = [&] () {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                auto piece = text(i);
+                GraphBuilder& local = locals[i];
+                stopped[i] = scan_edges(piece.first, piece.second, [&] (std::string_view departure, std::string_view destination) {
+                    local.addEdge(departure, destination);
+                }) != nullptr;
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    size_t workers = std::max<size_t>(1, std::min(threads, count));
+    std::vector<std::future<void>> running;
+    for (size_t w = 1; w < workers; ++w) {
+        running.push_back(std::async(std::launch::async, work));
+    }
+    work();
+    for (auto& worker : running) {
+        worker.get();
+    }
+
+    // report the first failure in input order, & drop whatever follows a break
+    size_t used = count;
+    for (size_t i = 0; i < count && i < used; ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        if (stop_at_break && stopped[i]) {
+            used = i + 1;
+        }
+    }
+    locals.resize(used);
+
+    GraphBuilder builder;
+    builder.merge(locals, threads);
+    return builder.build(threads);
+}
+
 /**
 * @brief Reads the contents of a flight table
 * as specified by the filename, into an undirected
@@ -43,26 +202,9 @@ Graph VertexCover::readFromFile(const std::string& filename) {
     // stores all edges
     Graph unsorted_graph;
 
-    // read in file
-    std::ifstream file(filename);
+    read_edges(filename, [&] (std::string_view from, std::string_view to) {
+        Vertex departure(from), destination(to);
 
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file.");
-    }
-
-    // goes through file, line by line
-    // ex. Departure (15: 43) - SRB | Destination  (03: 36) - WIE
-    std::string line;
-    while (std::getline(file, line)) {
-        int seperater = line.find("|");
-
-        if (seperater == std::string::npos) {
-            break;
-        }
-
-        Vertex departure = find_location(line.substr(0,seperater)); 
-        Vertex destination = find_location(line.substr(seperater+1));
-        
         // check if in graph then add
         if (unsorted_graph.find(departure) != unsorted_graph.end()) {
             unsorted_graph.at(departure).insert(destination);
@@ -77,11 +219,84 @@ Graph VertexCover::readFromFile(const std::string& filename) {
         } else {
             unsorted_graph.insert({departure,{destination}});
         }
+    });
+
+    return unsorted_graph;
+}
+
+/**
+* @brief Reads the contents of a flight table, like readFromFile(),
+* straight into a CompactGraph: airport codes are interned
+* & no per-vertex sets are ever built.
+*
+* @param filename (a const. string reference) The filename of the file to be read
+* @return (CompactGraph) The resultant graph described by the file's contents.
+*
+* @throws (std::runtime_error) If the file cannot be opened for some reason
+*/
+CompactGraph VertexCover::readCompactFromFile(const std::string& filename) {
+    GraphBuilder builder;
+    read_edges(filename, [&] (std::string_view departure, std::string_view destination) {
+        builder.addEdge(departure, destination);
+    });
+    return builder.build();
+}
 
+/**
+* @brief Reads the contents of a flight table into a CompactGraph, like
+* readCompactFromFile(filename), splitting the file into pieces at line boundaries
+* & parsing them on up to `threads` threads at once.
+*
+* Every piece is parsed into its own GraphBuilder, & the builders are merged & their
+* edges sorted & deduplicated in parallel (see GraphBuilder::merge() & build()).
+* The graph matches readCompactFromFile(filename), vertex ids included.
+*
+* @param filename (a const. string reference) The filename of the file to be read
+* @param threads (a const. size_t reference) The maximum number of threads to parse with
+* @return (CompactGraph) The resultant graph described by the file's contents.
+*
+* @throws (std::runtime_error) If the file cannot be opened for some reason
+*/
+CompactGraph VertexCover::readCompactFromFile(const std::string& filename, const size_t& threads) {
+    MappedFile file(filename);
+    const char* end = file.data_ + file.length_;
+
+    // piece i starts at the first line starting at or after byte i * length / pieces
+    size_t pieces = std::max<size_t>(1, threads);
+    std::vector<const char*> starts(pieces + 1, end);
+    starts[0] = file.data_;
+    for (size_t i = 1; i < pieces; ++i) {
+        const char* from = std::max(file.data_ + file.length_ * i / pieces, starts[i - 1]);
+        const char* newline = (from < end) ? static_cast<const char*>(std::memchr(from, '\n', end - from)) : nullptr;
+        starts[i] = (newline != nullptr) ? newline + 1 : end;
     }
-    file.close();
 
-    return unsorted_graph;
+    return build_in_parallel(pieces, threads, [&] (size_t i) {
+        return std::make_pair(starts[i], starts[i + 1]);
+    }, true);
+}
+
+/**
+* @brief Reads the contents of several flight tables into one CompactGraph,
+* parsing up to `threads` files at once.
+*
+* Each file is read like readCompactFromFile(filename) (so a line without a "|" only
+* ends its own file), into its own GraphBuilder; the builders are then merged in the
+* order of `filenames`, & the edges sorted & deduplicated in parallel. Vertex ids
+* are given out in order of first appearance, as if the files were read one after another.
+*
+* @param filenames (a const. vector reference) The filenames of the files to be read
+* @param threads (a const. size_t reference) The maximum number of threads to parse with
+* @return (CompactGraph) The graph of every route in every file.
+*
+* @throws (std::runtime_error) If any file cannot be opened for some reason
+*/
+CompactGraph VertexCover::readCompactFromFiles(const std::vector<std::string>& filenames, const size_t& threads) {
+    std::vector<std::unique_ptr<MappedFile>> files(filenames.size());
+    return build_in_parallel(filenames.size(), threads, [&] (size_t i) {
+        files[i].reset(new MappedFile(filenames[i]));
+        return std::make_pair(files[i]->data_, files[i]->data_ + files[i]->length_);
+    }, false);
 }
 
 /**
@@ -111,14 +326,14 @@ Graph VertexCover::readFromFile(const std::string& filename) {
 
     while ((g.size() > 1)) {
         // find pair with largest number of nieghbors
-        auto most_edges = std::max_element(g.begin(),g.end(),[] (auto v1, auto v2) { return v1.second.size() < v2.second.size(); } );
+        auto most_edges = std::max_element(g.begin(),g.end(),[] (const auto& v1, const auto& v2) { return v1.second.size() < v2.second.size(); } );
         // if nothing returned
         if (most_edges == g.end()) {
             break;
         }
 
         Vertex next_vertex = (*most_edges).first;
-        Neighbors next_neighbors = (*most_edges).second;
+        Neighbors next_neighbors = std::move((*most_edges).second); // erased next anyway
 
         // add edge
         cover_set.insert(next_vertex);
@@ -142,4 +357,137 @@ Graph VertexCover::readFromFile(const std::string& filename) {
     }
 
     return cover_set;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Generates the same kind of greedy vertex cover as cover_graph(Graph),
+ * on a CompactGraph, without copying or modifying it.
+ *
+ * Remaining degrees live in one array indexed by VertexId, & the largest is found
+ * with a lazy max-heap: when a vertex is covered, each uncovered neighbour's degree drops
+ * & is pushed again, & stale heap entries are skipped as they surface. O((V + E) log V).
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (std::unordered_set<Vertex>) The set of vertices
+ * that forms a vertex cover of the graph.
+ */
+std::unordered_set<Vertex> VertexCover::cover_graph(const CompactGraph& g) {
+    Neighbors cover_set;
+
+    // remaining degree of every vertex, which is 0 once it's covered or has no uncovered edges
+    std::vector<size_t> degree(g.vertexCount());
+    std::vector<std::pair<size_t, VertexId>> heap; // (degree, -id), so ties pop the lowest id
+    heap.reserve(g.vertexCount());
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        degree[v] = g.degree(v);
+        if (degree[v] > 0) {
+            heap.push_back({degree[v], ~v});
+        }
+    }
+    std::make_heap(heap.begin(), heap.end());
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end());
+        auto top = heap.back();
+        heap.pop_back();
+
+        VertexId next_vertex = ~top.second;
+        // skip entries whose degree has since dropped
+        if (top.first != degree[next_vertex] || top.first == 0) {
+            continue;
+        }
+
+        // add vertex, & remove its edges
+        cover_set.insert(g.name(next_vertex));
+        degree[next_vertex] = 0;
+        for (const VertexId* n = g.neighborsBegin(next_vertex); n != g.neighborsEnd(next_vertex); ++n) {
+            if (degree[*n] > 0) {
+                degree[*n]--;
+                if (degree[*n] > 0) {
+                    heap.push_back({degree[*n], ~*n});
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            }
+        }
+    }
+
+    return cover_set;
+}
+
+/**
+ * @brief Generates the same kind of greedy vertex cover as cover_graph(),
+ * using a bucket queue of vertices by remaining degree, in O(V + E).
+ *
+ * Bucket d is an intrusive doubly linked list of the uncovered vertices of degree d,
+ * so moving a neighbour down a bucket as its degree drops is O(1). Degrees only ever drop,
+ * so the search for the highest non-empty bucket only ever moves down, at most
+ * max degree steps in total.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (std::unordered_set<Vertex>) The set of vertices
+ * that forms a vertex cover of the graph.
+ */
+std::unordered_set<Vertex> VertexCover::cover_graph_bucketed(const CompactGraph& g) {
+    const VertexId NONE = ~VertexId(0);
+    Neighbors cover_set;
+
+    size_t max_degree = 0;
+    std::vector<size_t> degree(g.vertexCount());
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        degree[v] = g.degree(v);
+        max_degree = std::max(max_degree, degree[v]);
+    }
+
+    // bucket[d] is the first vertex of degree d, & next/prev link the rest of its bucket
+    std::vector<VertexId> bucket(max_degree + 1, NONE), next(g.vertexCount(), NONE), prev(g.vertexCount(), NONE);
+    auto link = [&] (const VertexId& v) {
+        next[v] = bucket[degree[v]];
+        prev[v] = NONE;
+        if (next[v] != NONE) {
+            prev[next[v]] = v;
+        }
+        bucket[degree[v]] = v;
+    };
+    auto unlink = [&] (const VertexId& v) {
+        if (prev[v] != NONE) {
+            next[prev[v]] = next[v];
+        } else {
+            bucket[degree[v]] = next[v];
+        }
+        if (next[v] != NONE) {
+            prev[next[v]] = prev[v];
+        }
+    };
+    for (VertexId v = 0; v < g.vertexCount(); ++v) {
+        if (degree[v] > 0) {
+            link(v);
+        }
+    }
+
+    while (true) {
+        while (max_degree > 0 && bucket[max_degree] == NONE) {
+            max_degree--;
+        }
+        if (max_degree == 0) {
+            break;
+        }
+
+        // add vertex, & remove its edges
+        VertexId next_vertex = bucket[max_degree];
+        unlink(next_vertex);
+        degree[next_vertex] = 0;
+        cover_set.insert(g.name(next_vertex));
+
+        for (const VertexId* n = g.neighborsBegin(next_vertex); n != g.neighborsEnd(next_vertex); ++n) {
+            if (degree[*n] > 0) {
+                unlink(*n);
+                degree[*n]--;
+                if (degree[*n] > 0) {
+                    link(*n);
+                }
+            }
+        }
+    }
+
+    return cover_set;
+}
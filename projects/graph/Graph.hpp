@@ -12,6 +12,8 @@
 #include <string>
 // #include <map>
 
+#include "CompactGraph.hpp"
+
 using Vertex = std::string;
 using Neighbors = std::unordered_set<Vertex>;
 using Graph = std::unordered_map<Vertex, Neighbors>;
@@ -29,6 +31,55 @@ namespace VertexCover {
 */
 Graph readFromFile(const std::string& filename);
 
+/**
+* @brief Reads the contents of a flight table, like readFromFile(),
+* straight into a CompactGraph: airport codes are interned
+* & no per-vertex sets are ever built.
+*
+* Both readers memory-map the file & scan it in place with std::string_view,
+* so a line costs no allocations here beyond a new airport's name.
+*
+* @param filename (a const. string reference) The filename of the file to be read
+* @return (CompactGraph) The resultant graph described by the file's contents.
+*
+* @throws (std::runtime_error) If the file cannot be opened for some reason
+*/
+CompactGraph readCompactFromFile(const std::string& filename);
+
+/**
+* @brief Reads the contents of a flight table into a CompactGraph, like
+* readCompactFromFile(filename), splitting the file into pieces at line boundaries
+* & parsing them on up to `threads` threads at once.
+*
+* Every piece is parsed into its own GraphBuilder, & the builders are merged & their
+* edges sorted & deduplicated in parallel (see GraphBuilder::merge() & build()).
+* The graph matches readCompactFromFile(filename), vertex ids included.
+*
+* @param filename (a const. string reference) The filename of the file to be read
+* @param threads (a const. size_t reference) The maximum number of threads to parse with
+* @return (CompactGraph) The resultant graph described by the file's contents.
+*
+* @throws (std::runtime_error) If the file cannot be opened for some reason
+*/
+CompactGraph readCompactFromFile(const std::string& filename, const size_t& threads);
+
+/**
+* @brief Reads the contents of several flight tables into one CompactGraph,
+* parsing up to `threads` files at once.
+*
+* Each file is read like readCompactFromFile(filename) (so a line without a "|" only
+* ends its own file), into its own GraphBuilder; the builders are then merged in the
+* order of `filenames`, & the edges sorted & deduplicated in parallel. Vertex ids
+* are given out in order of first appearance, as if the files were read one after another.
+*
+* @param filenames (a const. vector reference) The filenames of the files to be read
+* @param threads (a const. size_t reference) The maximum number of threads to parse with
+* @return (CompactGraph) The graph of every route in every file.
+*
+* @throws (std::runtime_error) If any file cannot be opened for some reason
+*/
+CompactGraph readCompactFromFiles(const std::vector<std::string>& filenames, const size_t& threads);
+
 /**
  * @brief Generates a sub-optimal minimumum vertex cover
  * by repeatedly choosing the largest degree vertex & 
@@ -43,5 +94,36 @@ Graph readFromFile(const std::string& filename);
  */
 std::unordered_set<Vertex> cover_graph(Graph g);
 
+/**
+ * @brief Generates the same kind of greedy vertex cover as cover_graph(Graph),
+ * on a CompactGraph, without copying or modifying it.
+ *
+ * Remaining degrees live in one array indexed by VertexId, & the largest is found
+ * with a lazy max-heap: when a vertex is covered, each uncovered neighbour's degree drops
+ * & is pushed again, & stale heap entries are skipped as they surface. O((V + E) log V).
+ * Ties between vertices of equal degree go to the lowest VertexId.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (std::unordered_set<Vertex>) The set of vertices
+ * that forms a vertex cover of the graph.
+ */
+std::unordered_set<Vertex> cover_graph(const CompactGraph& g);
+
+/**
+ * @brief Generates the same kind of greedy vertex cover as cover_graph(),
+ * using a bucket queue of vertices by remaining degree, in O(V + E).
+ *
+ * Bucket d is an intrusive doubly linked list of the uncovered vertices of degree d,
+ * so moving a neighbour down a bucket as its degree drops is O(1), & the highest
+ * non-empty bucket is found by a pointer that only ever moves down.
+ * Ties between vertices of equal degree go to whichever entered its bucket last,
+ * so the cover may differ from cover_graph()'s, though it's found the same way.
+ *
+ * @param g (const. CompactGraph reference) The graph for which to generate a vertex cover.
+ * @return (std::unordered_set<Vertex>) The set of vertices
+ * that forms a vertex cover of the graph.
+ */
+std::unordered_set<Vertex> cover_graph_bucketed(const CompactGraph& g);
+
 void displayGraphHidden(Graph g);
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Compare.hpp"
+#include "Inventory.hpp"
+#include "ItemBTree.hpp"
+
+// Used for aliasing the template
+struct BTree { };
+
+template <class Comparator>
+class Inventory<Comparator, BTree> {
+private:
+    ItemBTree<Comparator> items_;
+
+protected:
+    // A pointer to a dynamically allocated Item outside of the Player's bag
+    Item* equipped_;
+
+    // The total weight of all items in `inventory_grid_`
+    float weight_;
+
+public:
+    /**
+     * @brief Default constructor for the Inventory template class.
+     *
+     * Initializes an empty inventory with no items, no equipped item,
+     * and zero total weight.
+     *
+     * @tparam Comparator The comparison class for querying items
+     */
+    Inventory();
+
+    /**
+     * @brief Retrieves the value stored in `equipped_`
+     * @return The Item pointer stored in `equipped_`
+     */
+    Item* getEquipped() const;
+
+    /**
+     * @brief Equips a new item.
+     * @param itemToEquip A pointer to the item to equip.
+     * @post Updates `equipped` to the specified item
+     * without deallocating the original.
+     */
+    void equip(Item* itemToEquip);
+
+    /**
+     * @brief Discards the currently equipped item.
+     * @post Deallocates the item pointed to by `equipped`
+     * and sets `equipped` to nullptr, if `equipped` is not nullptr already.
+     */
+    void discardEquipped();
+
+    /**
+     * @brief Retrieves the value stored in `weight_`
+     * @return The float value stored in `weight_`
+     */
+    float getWeight() const;
+
+    /**
+     * @brief Retrieves the count of Items in the items_ ItemBTree
+     */
+    size_t size() const;
+
+    /**
+     * @brief Retrieves a copy of the container holding inventory items.
+     * @return An ItemBTree with the correct Comparison class in the inventory
+     */
+    ItemBTree<Comparator> getItems() const;
+
+    /**
+     * @brief Exposes a read-only view of the container holding inventory items.
+     *
+     * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+     * The view iterates in-order by Comparator; its iterators stay valid until the inventory is modified.
+     *
+     * @return A const reference to the container of items in the inventory
+     */
+    const ItemBTree<Comparator>& items() const;
+
+    /**
+     * @brief Attempts to add a new item to the inventory.
+     *
+     * @param target Item to be added to the inventory
+     * @return true if the item was successfully added, false if an item
+     *         with the same name already exists
+     * @post Updates the weight_ member to reflect the new Item pickup
+     */
+    bool pickup(const Item& target);
+
+    /**
+     * @brief Attempts to add every item of a range to the inventory.
+     *
+     * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+     * @return The number of Items added; Items whose name is already in the
+     *         inventory, or earlier in the batch, are skipped like in pickup
+     * @post Updates the weight_ member to reflect the new Items
+     * @note Equivalent to calling pickup for every Item in order.
+     */
+    template <class Range>
+    size_t pickupBatch(const Range& batch);
+
+    /**
+     * @brief Attempts to remove an item from the inventory by name.
+     *
+     * @param name Name of the item to be removed
+     * @return true if the item was successfully removed, false if the
+     *         item was not found in the inventory
+     * @post Updates the weight_ member to reflect removing the Item
+     */
+    bool discard(const std::string& itemName);
+
+    /**
+     * @brief Checks if an item with the given name exists in the inventory.
+     *
+     * @param name Name of the item to search for
+     * @return true if the item exists in the inventory, false otherwise
+     */
+    bool contains(const std::string& itemName) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range.
+     *
+     * Returns a set of items that fall between the start and end items
+     * according to the specified Comparator (inclusive on both ends)
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @return std::unordered_set of items within the specified range
+     *
+     * @note Returns an empty set if the end item is less than the start item
+     * @example To select all Items with weights 0.4 to 10.9, we'd setup the class & parameters as such:
+     *  - this Inventory object is of type Inventory<CompareItemWeight>
+     *  - start = Item("some_name", 0.4, ItemType::None)
+     *  - end = = Item("some_other_name", 10.9, ItemType::None)
+     *
+     */
+    std::unordered_set<Item> query(const Item& start, const Item& end) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range,
+     * appending them to a caller-provided vector in sorted order.
+     *
+     * Unlike the std::unordered_set overload, this neither hashes nor allocates per
+     * Item found, & lets the caller reuse the same vector across queries.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     *
+     * @note Appends nothing if the end item is less than the start item
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
+    /**
+     * @brief Invokes a callback on every item within a specified range, in sorted order,
+     * without copying any Items.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param visit A callable invoked with a const Item& for every matching Item
+     *
+     * @note Visits nothing if the end item is less than the start item
+     * @example To total the weight of all armor, in an Inventory<CompareItemType, BTree> inv:
+     *  float total = 0;
+     *  inv.forEachInRange(Item("", 0, ARMOR), Item("", 0, ARMOR), [&total](const Item& i) { total += i.weight_; });
+     */
+    template <class Visitor>
+    void forEachInRange(const Item& start, const Item& end, Visitor visit) const;
+
+    /**
+     * @brief Destructor for the Inventory class.
+     * @post Deallocates any dynamically allocated resources.
+     */
+    ~Inventory();
+};
+
+#include "BTreeInventory.cpp"
\ No newline at end of file
@@ -18,7 +18,7 @@ bool CompareItemName::lessThan(const Item& a, const Item& b) {
  * @return true if items have equal names
  */
 bool CompareItemName::equal(const Item& a, const Item& b) {
-    return a.name_.compare(b.name_) == 0;
+    return a.name_ == b.name_;
 }
 
 /**
@@ -0,0 +1,413 @@
+#include "ConcurrentInventory.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Adds w to an atomic total with a compare-and-swap loop
+ * (std::atomic<float> has no fetch_add before C++20)
+ */
+inline void addWeight(std::atomic<float>& total, const float& w)
+{
+    float current = total.load();
+    // On failure, current is reloaded with the total another thread just stored
+    while (!total.compare_exchange_weak(current, current + w)) { }
+}
+
+// =========== HASH  ===========
+
+template <class Comparator>
+ConcurrentInventory<Comparator, std::unordered_set<Item>>::Stripe::Stripe()
+    : version_ { 0 }
+    , stale_queries_ { 0 }
+{
+}
+
+/**
+ * @brief Constructs an empty inventory
+ */
+template <class Comparator>
+ConcurrentInventory<Comparator, std::unordered_set<Item>>::ConcurrentInventory()
+    : weight_ { 0 }
+    , size_ { 0 }
+{
+}
+
+/**
+ * @brief Returns the stripe holding the Item of a given name
+ */
+template <class Comparator>
+typename ConcurrentInventory<Comparator, std::unordered_set<Item>>::Stripe&
+ConcurrentInventory<Comparator, std::unordered_set<Item>>::stripeOf(const std::string& name)
+{
+    return stripes_[std::hash<std::string> {}(name) % STRIPES];
+}
+
+template <class Comparator>
+const typename ConcurrentInventory<Comparator, std::unordered_set<Item>>::Stripe&
+ConcurrentInventory<Comparator, std::unordered_set<Item>>::stripeOf(const std::string& name) const
+{
+    return stripes_[std::hash<std::string> {}(name) % STRIPES];
+}
+
+/**
+ * @brief Attempts to add a new item to the inventory.
+ *
+ * @param target Item to be added to the inventory
+ * @return true if the item was successfully added, false if an item
+ *         with the same name already exists
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, std::unordered_set<Item>>::pickup(const Item& target)
+{
+    Stripe& stripe = stripeOf(target.name_);
+    {
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+        if (!stripe.items_.pickup(target)) {
+            return false;
+        }
+        stripe.version_++;
+        stripe.stale_queries_ = 0;
+    }
+    addWeight(weight_, target.weight_);
+    size_++;
+    return true;
+}
+
+/**
+ * @brief Attempts to remove an item from the inventory by name.
+ *
+ * @param itemName Name of the item to be removed
+ * @return true if the item was successfully removed, false if the
+ *         item was not found in the inventory
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, std::unordered_set<Item>>::discard(const std::string& itemName)
+{
+    Stripe& stripe = stripeOf(itemName);
+    float change;
+    {
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+        float before = stripe.items_.getWeight();
+        if (!stripe.items_.discard(itemName)) {
+            return false;
+        }
+        stripe.version_++;
+        stripe.stale_queries_ = 0;
+        change = stripe.items_.getWeight() - before;
+    }
+    addWeight(weight_, change);
+    size_--;
+    return true;
+}
+
+/**
+ * @brief Checks if an item with the given name exists in the inventory.
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, std::unordered_set<Item>>::contains(const std::string& itemName) const
+{
+    const Stripe& stripe = stripeOf(itemName);
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex_);
+    return stripe.items_.contains(itemName);
+}
+
+/**
+ * @brief Appends a stripe's Items in the range, in ascending order by Comparator
+ *
+ * Reads the stripe's snapshot if no change was made since it was taken. Otherwise scans
+ * the stripe under its shared lock, copying it too if enough queries have scanned it in a
+ * row, & sorts that copy into the new snapshot after unlocking, so writers never wait for a sort.
+ */
+template <class Comparator>
+void ConcurrentInventory<Comparator, std::unordered_set<Item>>::queryStripe(const Stripe& stripe,
+    const Item& start, const Item& end, std::vector<Item>& result) const
+{
+    auto lessThan = [](const Item& a, const Item& b) { return Comparator::lessThan(a, b); };
+
+    // A writer bumps the version only once its change is complete, so a matching snapshot
+    // is the stripe as it was at some point during this call
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&stripe.snapshot_);
+    if (snapshot && snapshot->version_ == stripe.version_) {
+        const std::vector<Item>& sorted = snapshot->sorted_;
+        auto first = std::lower_bound(sorted.begin(), sorted.end(), start, lessThan);
+        for (; first != sorted.end() && Comparator::leq(*first, end); ++first) {
+            result.push_back(*first);
+        }
+        return;
+    }
+
+    size_t first = result.size();
+    std::shared_ptr<Snapshot> copy;
+    {
+        std::shared_lock<std::shared_mutex> lock(stripe.mutex_);
+        const std::unordered_set<Item>& items = stripe.items_.items();
+
+        // A scan costs n comparisons & a sort about n log2(n), so sort once log2(n) queries
+        // in a row have scanned; only the query that reaches the count copies the stripe
+        size_t log_n = 0;
+        for (size_t n = items.size(); n > 1; n >>= 1) {
+            log_n++;
+        }
+        if (stripe.stale_queries_++ == log_n) {
+            copy = std::make_shared<Snapshot>();
+            copy->version_ = stripe.version_;
+            copy->sorted_.reserve(items.size());
+        }
+
+        for (const Item& value : items) {
+            if (Comparator::leq(start, value) && Comparator::leq(value, end)) {
+                result.push_back(value);
+            }
+            if (copy) {
+                copy->sorted_.push_back(value);
+            }
+        }
+    }
+    std::sort(result.begin() + first, result.end(), lessThan);
+
+    if (copy) {
+        std::sort(copy->sorted_.begin(), copy->sorted_.end(), lessThan);
+
+        // A slow copier mustn't replace a newer snapshot published meanwhile
+        std::shared_ptr<const Snapshot> published(std::move(copy));
+        std::shared_ptr<const Snapshot> current = std::atomic_load(&stripe.snapshot_);
+        while ((!current || current->version_ < published->version_)
+            && !std::atomic_compare_exchange_weak(&stripe.snapshot_, &current, published)) { }
+    }
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range
+ * (inclusive on both ends, according to the Comparator).
+ *
+ * Each stripe answers in sorted order, so the stripes' results are merged at the end.
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param result The vector to which matching Items are appended, in ascending order by Comparator
+ */
+template <class Comparator>
+void ConcurrentInventory<Comparator, std::unordered_set<Item>>::query(const Item& start, const Item& end,
+    std::vector<Item>& result) const
+{
+    size_t first = result.size();
+    for (const Stripe& stripe : stripes_) {
+        size_t merged = result.size();
+        queryStripe(stripe, start, end, result);
+        std::inplace_merge(result.begin() + first, result.begin() + merged, result.end(),
+            [](const Item& a, const Item& b) { return Comparator::lessThan(a, b); });
+    }
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range.
+ * @return std::unordered_set of items within the specified range
+ */
+template <class Comparator>
+std::unordered_set<Item> ConcurrentInventory<Comparator, std::unordered_set<Item>>::query(const Item& start,
+    const Item& end) const
+{
+    std::vector<Item> matching;
+    query(start, end, matching);
+    return std::unordered_set<Item>(matching.begin(), matching.end());
+}
+
+/**
+ * @brief Retrieves the total weight of every item, without locking
+ */
+template <class Comparator>
+float ConcurrentInventory<Comparator, std::unordered_set<Item>>::getWeight() const
+{
+    return weight_;
+}
+
+/**
+ * @brief Retrieves the number of items, without locking
+ */
+template <class Comparator>
+size_t ConcurrentInventory<Comparator, std::unordered_set<Item>>::size() const
+{
+    return size_;
+}
+
+// =========== TREE  ===========
+
+template <class Comparator>
+ConcurrentInventory<Comparator, Tree>::Copy::Copy()
+    : released_ { true }
+{
+}
+
+template <class Comparator>
+ConcurrentInventory<Comparator, Tree>::Copy::Copy(const Inventory<Comparator, Tree>& items)
+    : items_ { items }
+    , released_ { true }
+{
+}
+
+/**
+ * @brief Constructs an empty inventory
+ */
+template <class Comparator>
+ConcurrentInventory<Comparator, Tree>::ConcurrentInventory()
+    : weight_ { 0 }
+    , size_ { 0 }
+{
+    copies_.push_back(std::make_unique<Copy>());
+    copies_.push_back(std::make_unique<Copy>());
+    spare_ = copies_[1].get();
+    publish(copies_[0].get());
+}
+
+/**
+ * @brief Points current_ at a copy, flagging it released once its last reader lets go
+ */
+template <class Comparator>
+void ConcurrentInventory<Comparator, Tree>::publish(Copy* copy)
+{
+    copy->released_ = false;
+    published_ = copy;
+    // The deleter runs after the last reader's release of its shared_ptr, so the writer
+    // seeing released_ (acquire) also sees every read of the copy finished
+    std::shared_ptr<const Inventory<Comparator, Tree>> snapshot(&copy->items_,
+        [copy](const Inventory<Comparator, Tree>*) { copy->released_.store(true, std::memory_order_release); });
+    std::atomic_store(&current_, std::move(snapshot));
+}
+
+/**
+ * @brief Applies a change to the spare copy & publishes it: the spare first catches up with
+ * the changes since it was published, or is replaced by a fresh copy if readers still hold it
+ *
+ * @param change A callable taking an Inventory<Comparator, Tree>& & returning true if it
+ *      changed it; it is kept to be replayed on the next spare, so it must capture by value
+ * @return The result of change
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, Tree>::write(Change change)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+
+    if (spare_->released_.load(std::memory_order_acquire)) {
+        for (const Change& missed : pending_) {
+            missed(spare_->items_);
+        }
+    } else {
+        // Readers are still on the spare: copy rather than wait, & free it once they are done
+        copies_.push_back(std::make_unique<Copy>(published_->items_));
+        spare_ = copies_.back().get();
+    }
+    pending_.clear();
+
+    if (!change(spare_->items_)) {
+        return false; // the spare now matches the published copy
+    }
+
+    Copy* previous = published_;
+    publish(spare_);
+    spare_ = previous;
+    pending_.push_back(std::move(change));
+
+    // Free the copies replaced while still being read, now that their readers are gone
+    copies_.erase(std::remove_if(copies_.begin(), copies_.end(), [this](const std::unique_ptr<Copy>& copy) {
+        return copy.get() != published_ && copy.get() != spare_ && copy->released_.load(std::memory_order_acquire);
+    }), copies_.end());
+
+    weight_ = published_->items_.getWeight();
+    size_ = published_->items_.size();
+    return true;
+}
+
+/**
+ * @brief Runs any read-only operation on a consistent snapshot of the inventory
+ *
+ * @param reader A callable taking a const Inventory<Comparator, Tree>&; it must not keep
+ *      references into the inventory after returning
+ * @return Whatever reader returns
+ */
+template <class Comparator>
+template <class Reader>
+auto ConcurrentInventory<Comparator, Tree>::read(Reader reader) const
+    -> decltype(reader(std::declval<const Inventory<Comparator, Tree>&>()))
+{
+    // Holding the snapshot keeps the writer off this copy until the read is done, even if reader throws
+    std::shared_ptr<const Inventory<Comparator, Tree>> snapshot = std::atomic_load(&current_);
+    return reader(*snapshot);
+}
+
+/**
+ * @brief Attempts to add a new item to the inventory.
+ *
+ * @param target Item to be added to the inventory
+ * @return true if the item was successfully added, false if an item
+ *         with the same name already exists
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, Tree>::pickup(const Item& target)
+{
+    return write([target](Inventory<Comparator, Tree>& copy) { return copy.pickup(target); });
+}
+
+/**
+ * @brief Attempts to remove an item from the inventory by name.
+ *
+ * @param itemName Name of the item to be removed
+ * @return true if the item was successfully removed, false if the
+ *         item was not found in the inventory
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, Tree>::discard(const std::string& itemName)
+{
+    return write([itemName](Inventory<Comparator, Tree>& copy) { return copy.discard(itemName); });
+}
+
+/**
+ * @brief Checks if an item with the given name exists in the inventory.
+ */
+template <class Comparator>
+bool ConcurrentInventory<Comparator, Tree>::contains(const std::string& itemName) const
+{
+    return read([&itemName](const Inventory<Comparator, Tree>& copy) { return copy.contains(itemName); });
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range
+ * (inclusive on both ends, according to the Comparator).
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param result The vector to which matching Items are appended, in ascending order by Comparator
+ */
+template <class Comparator>
+void ConcurrentInventory<Comparator, Tree>::query(const Item& start, const Item& end, std::vector<Item>& result) const
+{
+    read([&](const Inventory<Comparator, Tree>& copy) { copy.query(start, end, result); });
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range.
+ * @return std::unordered_set of items within the specified range
+ */
+template <class Comparator>
+std::unordered_set<Item> ConcurrentInventory<Comparator, Tree>::query(const Item& start, const Item& end) const
+{
+    return read([&](const Inventory<Comparator, Tree>& copy) { return copy.query(start, end); });
+}
+
+/**
+ * @brief Retrieves the total weight of every item, without locking
+ */
+template <class Comparator>
+float ConcurrentInventory<Comparator, Tree>::getWeight() const
+{
+    return weight_;
+}
+
+/**
+ * @brief Retrieves the number of items, without locking
+ */
+template <class Comparator>
+size_t ConcurrentInventory<Comparator, Tree>::size() const
+{
+    return size_;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file ConcurrentInventory.hpp
+ * @brief Defines thread-safe wrappers around the hash & tree Inventory backends,
+ * for many threads reading an inventory while another mutates it
+ */
+
+#pragma once
+
+#include "Compare.hpp"
+#include "HashInventory.hpp"
+#include "TreeInventory.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Adds w to an atomic total with a compare-and-swap loop
+ * (std::atomic<float> has no fetch_add before C++20)
+ */
+inline void addWeight(std::atomic<float>& total, const float& w);
+
+/**
+ * @class ConcurrentInventory
+ * @brief A thread-safe Inventory: pickup & discard may run concurrently with
+ * contains, query, getWeight & size on other threads.
+ *
+ * Only the hash & tree backends are wrapped, by the specializations below.
+ * The equipped item isn't wrapped; equip it on a plain Inventory instead.
+ *
+ * @tparam Comparator The comparison class for querying items
+ * @tparam Container The backend tag of the wrapped Inventory
+ */
+template <class Comparator, class Container>
+class ConcurrentInventory;
+
+/**
+ * @brief The hash backend, split into STRIPES independent Inventories by name hash,
+ * each guarded by its own reader-writer lock.
+ *
+ * A pickup or discard exclusively locks a single stripe, so it only ever waits for
+ * readers of that stripe; contains shares the lock of one stripe. getWeight & size read
+ * atomics, so they never wait at all.
+ *
+ * A query answers each unchanged stripe from a sorted snapshot of it, without locking.
+ * A stripe changed since its snapshot is scanned under its shared lock instead, so a writer
+ * waits at most for one scan of one stripe, never for a sort. Once log2(n) queries in a row
+ * have scanned a stripe, one of them copies it during its scan & sorts the copy after
+ * releasing the lock, publishing it as the stripe's new snapshot.
+ *
+ * A query is consistent within each stripe, but not across them: an Item picked up
+ * during a query may be reported even though one picked up before it isn't.
+ */
+template <class Comparator>
+class ConcurrentInventory<Comparator, std::unordered_set<Item>> {
+public:
+    // The number of stripes; writers to different stripes never contend
+    static const size_t STRIPES = 16;
+
+    /**
+     * @brief Constructs an empty inventory
+     */
+    ConcurrentInventory();
+
+    ConcurrentInventory(const ConcurrentInventory&) = delete;
+    ConcurrentInventory& operator=(const ConcurrentInventory&) = delete;
+
+    /**
+     * @brief Attempts to add a new item to the inventory.
+     *
+     * @param target Item to be added to the inventory
+     * @return true if the item was successfully added, false if an item
+     *         with the same name already exists
+     */
+    bool pickup(const Item& target);
+
+    /**
+     * @brief Attempts to remove an item from the inventory by name.
+     *
+     * @param itemName Name of the item to be removed
+     * @return true if the item was successfully removed, false if the
+     *         item was not found in the inventory
+     */
+    bool discard(const std::string& itemName);
+
+    /**
+     * @brief Checks if an item with the given name exists in the inventory.
+     */
+    bool contains(const std::string& itemName) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range
+     * (inclusive on both ends, according to the Comparator).
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range.
+     * @return std::unordered_set of items within the specified range
+     */
+    std::unordered_set<Item> query(const Item& start, const Item& end) const;
+
+    /**
+     * @brief Retrieves the total weight of every item, without locking
+     */
+    float getWeight() const;
+
+    /**
+     * @brief Retrieves the number of items, without locking
+     */
+    size_t size() const;
+
+private:
+    struct Snapshot {
+        size_t version_;
+        std::vector<Item> sorted_;
+    };
+
+    struct alignas(64) Stripe {
+        mutable std::shared_mutex mutex_; // shared by readers, exclusive for pickup & discard
+
+        // Counts the changes to items_, so queries can tell whether the snapshot still matches it
+        std::atomic<size_t> version_;
+
+        // The items at some version, sorted by Comparator; replaced whole, through std::atomic_load & store
+        mutable std::shared_ptr<const Snapshot> snapshot_;
+
+        // The number of queries that scanned since the last change
+        mutable std::atomic<size_t> stale_queries_;
+
+        Inventory<Comparator, std::unordered_set<Item>> items_;
+
+        Stripe();
+    };
+
+    std::array<Stripe, STRIPES> stripes_;
+    std::atomic<float> weight_;
+    std::atomic<size_t> size_;
+
+    /**
+     * @brief Returns the stripe holding the Item of a given name
+     */
+    Stripe& stripeOf(const std::string& name);
+    const Stripe& stripeOf(const std::string& name) const;
+
+    /**
+     * @brief Appends a stripe's Items in the range, in ascending order by Comparator
+     */
+    void queryStripe(const Stripe& stripe, const Item& start, const Item& end, std::vector<Item>& result) const;
+};
+
+/**
+ * @brief The tree backend, published as immutable snapshots: readers never lock, & the
+ * writer never waits for them.
+ *
+ * Readers atomically load a std::shared_ptr to the current copy & read it, so a reader
+ * keeps the copy it started on even if a write publishes another meanwhile. A write
+ * 1) brings the spare copy (the one published before the current one) up to date by
+ *    replaying the changes made since, & applies its own change to it,
+ * 2) publishes it as the current copy, & keeps the old one, with the change, as the spare.
+ * A copy's shared_ptr flags it released once its last reader lets go of it. If the spare
+ * isn't released yet, the write copies the current copy instead (O(n)) rather than wait,
+ * & frees the stale spare once its readers are done. Writers are serialised by a mutex.
+ *
+ * So a write usually costs its change applied twice, like on two copies kept in step, & at
+ * worst one copy of the inventory, however long a read() or a wide query runs; every read
+ * sees a whole snapshot, & reads as fast as a single-threaded Inventory.
+ */
+template <class Comparator>
+class ConcurrentInventory<Comparator, Tree> {
+public:
+    /**
+     * @brief Constructs an empty inventory
+     */
+    ConcurrentInventory();
+
+    ConcurrentInventory(const ConcurrentInventory&) = delete;
+    ConcurrentInventory& operator=(const ConcurrentInventory&) = delete;
+
+    /**
+     * @brief Attempts to add a new item to the inventory.
+     *
+     * @param target Item to be added to the inventory
+     * @return true if the item was successfully added, false if an item
+     *         with the same name already exists
+     */
+    bool pickup(const Item& target);
+
+    /**
+     * @brief Attempts to remove an item from the inventory by name.
+     *
+     * @param itemName Name of the item to be removed
+     * @return true if the item was successfully removed, false if the
+     *         item was not found in the inventory
+     */
+    bool discard(const std::string& itemName);
+
+    /**
+     * @brief Checks if an item with the given name exists in the inventory.
+     */
+    bool contains(const std::string& itemName) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range
+     * (inclusive on both ends, according to the Comparator).
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range.
+     * @return std::unordered_set of items within the specified range
+     */
+    std::unordered_set<Item> query(const Item& start, const Item& end) const;
+
+    /**
+     * @brief Runs any read-only operation on a consistent snapshot of the inventory
+     *
+     * @param reader A callable taking a const Inventory<Comparator, Tree>&; it must not keep
+     *      references into the inventory after returning
+     * @return Whatever reader returns
+     * @example To count the items in a range: inv.read([&](const auto& i) { return i.countRange(start, end); });
+     */
+    template <class Reader>
+    auto read(Reader reader) const -> decltype(reader(std::declval<const Inventory<Comparator, Tree>&>()));
+
+    /**
+     * @brief Retrieves the total weight of every item, without locking
+     */
+    float getWeight() const;
+
+    /**
+     * @brief Retrieves the number of items, without locking
+     */
+    size_t size() const;
+
+private:
+    struct Copy {
+        Inventory<Comparator, Tree> items_;
+
+        // Set once no shared_ptr to this copy is left, i.e. no reader can still be on it
+        std::atomic<bool> released_;
+
+        Copy();
+        Copy(const Inventory<Comparator, Tree>& items);
+    };
+
+    using Change = std::function<bool(Inventory<Comparator, Tree>&)>;
+
+    // Only touched by the writer, under writer_mutex_
+    std::mutex writer_mutex_;
+    std::vector<std::unique_ptr<Copy>> copies_; // owns every copy, published or not
+    Copy* published_; // the copy current_ points to
+    Copy* spare_; // the copy published before it, behind by the changes in pending_
+    std::vector<Change> pending_;
+
+    // The copy readers read; only accessed through std::atomic_load & store.
+    // Declared after copies_, so its deleter runs while the copy it flags still exists.
+    std::shared_ptr<const Inventory<Comparator, Tree>> current_;
+
+    std::atomic<float> weight_;
+    std::atomic<size_t> size_;
+
+    /**
+     * @brief Applies a change to the spare copy & publishes it, as described above
+     *
+     * @param change A callable taking an Inventory<Comparator, Tree>& & returning true if it
+     *      changed it; it is kept to be replayed on the next spare, so it must capture by value
+     * @return The result of change
+     */
+    bool write(Change change);
+
+    /**
+     * @brief Points current_ at a copy, flagging it released once its last reader lets go
+     */
+    void publish(Copy* copy);
+};
+
+#include "ConcurrentInventory.cpp"
@@ -0,0 +1,244 @@
+#include "FlatHashInventory.hpp"
+
+/**
+ * @brief Default constructor for the Inventory template class.
+ *
+ * Initializes an empty inventory with no items, no equipped item,
+ * and zero total weight.
+ *
+ * @tparam Comparator The comparison class for querying items
+ */
+template <class Comparator>
+Inventory<Comparator, FlatHash>::Inventory()
+    : equipped_ { nullptr }
+    , weight_ { 0.0 }
+{
+}
+
+/**
+ * @brief Retrieves the value stored in `equipped_`
+ * @return The Item pointer stored in `equipped_`
+ */
+template <class Comparator>
+Item* Inventory<Comparator, FlatHash>::getEquipped() const
+{
+    return equipped_;
+}
+
+/**
+ * @brief Equips a new item.
+ * @param itemToEquip A pointer to the item to equip.
+ * @post Updates `equipped` to the specified item
+ * without deallocating the original.
+ */
+template <class Comparator>
+void Inventory<Comparator, FlatHash>::equip(Item* itemToEquip)
+{
+    equipped_ = itemToEquip;
+}
+
+/**
+ * @brief Discards the currently equipped item.
+ * @post Deallocates the item pointed to by `equipped`
+ * and sets `equipped` to nullptr, if `equipped` is not nullptr already.
+ */
+template <class Comparator>
+void Inventory<Comparator, FlatHash>::discardEquipped()
+{
+    if (equipped_ != nullptr) {
+        delete equipped_;
+        equipped_ = nullptr;
+    }
+}
+
+/**
+ * @brief Retrieves the value stored in `weight_`
+ * @return The float value stored in `weight_`
+ */
+template <class Comparator>
+float Inventory<Comparator, FlatHash>::getWeight() const
+{
+    return weight_;
+}
+
+/**
+ * @brief Retrieves the size of items_
+ */
+template <class Comparator>
+size_t
+Inventory<Comparator, FlatHash>::size() const
+{
+    return items_.size();
+}
+
+/**
+ * @brief Retrieves a copy of the container holding inventory items.
+ *
+ * @return Container of items in the inventory
+ */
+template <class Comparator>
+ItemFlatSet
+Inventory<Comparator, FlatHash>::getItems() const
+{
+    return items_;
+}
+
+/**
+ * @brief Exposes a read-only view of the container holding inventory items.
+ *
+ * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+ * The view iterates in no particular order; its iterators stay valid until the inventory is modified.
+ *
+ * @return A const reference to the container of items in the inventory
+ */
+template <class Comparator>
+const ItemFlatSet& Inventory<Comparator, FlatHash>::items() const
+{
+    return items_;
+}
+
+/**
+ * @brief Attempts to add a new item to the inventory.
+ *
+ * @param target Item to be added to the inventory
+ * @return true if the item was successfully added, false if an item
+ *         with the same name already exists
+ * @post Updates the weight_ member to reflect the new Item pickup
+ */
+template <class Comparator>
+bool Inventory<Comparator, FlatHash>::pickup(const Item& target)
+{
+    if (items_.insert(target)) {
+        weight_ += target.weight_;
+        ordered_.markStale();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Attempts to add every item of a range to the inventory.
+ *
+ * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+ * @return The number of Items added; Items whose name is already in the
+ *         inventory, or earlier in the batch, are skipped like in pickup
+ * @post Updates the weight_ member to reflect the new Items
+ * @note Reserves slots for the whole batch up front, so the table grows at most once.
+ */
+template <class Comparator>
+template <class Range>
+size_t Inventory<Comparator, FlatHash>::pickupBatch(const Range& batch)
+{
+    items_.reserve(items_.size() + std::distance(std::begin(batch), std::end(batch)));
+
+    size_t added = 0;
+    for (const Item& target : batch) {
+        if (items_.insert(target)) {
+            weight_ += target.weight_;
+            added++;
+        }
+    }
+    if (added) {
+        ordered_.markStale();
+    }
+    return added;
+}
+
+/**
+ * @brief Attempts to remove an item from the inventory by name.
+ *
+ * @param name Name of the item to be removed
+ * @return true if the item was successfully removed, false if the
+ *         item was not found in the inventory
+ * @post Updates the weight_ member to reflect removing the Item
+ */
+template <class Comparator>
+bool Inventory<Comparator, FlatHash>::discard(
+    const std::string& itemName)
+{
+    float erased_weight = 0;
+
+    if (items_.erase(itemName, erased_weight)) {
+        weight_ -= erased_weight;
+        ordered_.markStale();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Checks if an item with the given name exists in the inventory.
+ *
+ * @param name Name of the item to search for
+ * @return true if the item exists in the inventory, false otherwise
+ */
+template <class Comparator>
+bool Inventory<Comparator, FlatHash>::contains(
+    const std::string& itemName) const
+{
+    return items_.contains(itemName);
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range.
+ *
+ * Returns a set of items that fall between the start and end items
+ * according to the specified Comparator (inclusive on both ends)
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @return std::unordered_set of items within the specified range
+ *
+ * @note Returns an empty set if the end item is less than the start item
+ * @example To select all Items with weights 0.4 to 10.9, we'd setup the class & parameters as such:
+ *  - this Inventory object is of type Inventory<CompareItemWeight>
+ *  - start = Item("some_name", 0.4, ItemType::None)
+ *  - end = = Item("some_other_name", 10.9, ItemType::None)
+ *
+ */
+template <class Comparator>
+std::unordered_set<Item>
+Inventory<Comparator, FlatHash>::query(const Item& start,
+    const Item& end) const
+{
+    std::unordered_set<Item> return_items_;
+    ordered_.visit(items_, start, end, [&return_items_](const Item& value) { return_items_.insert(value); });
+    return return_items_;
+}
+
+/**
+ * @brief Queries the inventory for items within a specified range,
+ * appending them to a caller-provided vector in sorted order.
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param result The vector to which matching Items are appended, in ascending order by Comparator
+ *
+ * @note Appends nothing if the end item is less than the start item
+ */
+template <class Comparator>
+void Inventory<Comparator, FlatHash>::query(const Item& start,
+    const Item& end, std::vector<Item>& result) const
+{
+    size_t first = result.size();
+    bool sorted = ordered_.visit(items_, start, end, [&result](const Item& value) { result.push_back(value); });
+    if (!sorted) {
+        // A scan found the matches in slot order; sorting only them costs O(k log k)
+        std::sort(result.begin() + first, result.end(),
+            [](const Item& a, const Item& b) { return Comparator::lessThan(a, b); });
+    }
+}
+
+/**
+ * @brief Destructor for the Inventory class.
+ * @post Deallocates any dynamically allocated resources.
+ */
+template <class Comparator>
+Inventory<Comparator, FlatHash>::~Inventory()
+{
+    if (equipped_ != nullptr) {
+        delete equipped_;
+        equipped_ = nullptr;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Inventory.hpp"
+#include "ItemFlatSet.hpp"
+#include "OrderedItemIndex.hpp"
+#include <iterator>
+#include <unordered_set>
+#include <vector>
+
+// Used for aliasing the template
+struct FlatHash { };
+
+template <class Comparator>
+class Inventory<Comparator, FlatHash> {
+private:
+    ItemFlatSet items_;
+
+    /**
+     * `items_` sorted by Comparator, used to answer range queries by binary search.
+     * Items of an ItemFlatSet only move when it is modified, so the index can point
+     * to them; every pickup & discard marks it stale, & queries scan the slots
+     * until a run of them rebuilds it.
+     */
+    mutable OrderedItemIndex<Comparator> ordered_;
+
+protected:
+    // A pointer to a dynamically allocated Item outside of the Player's bag
+    Item* equipped_;
+
+    // The total weight of all items in `inventory_grid_`
+    float weight_;
+
+public:
+    /**
+     * @brief Default constructor for the Inventory template class.
+     *
+     * Initializes an empty inventory with no items, no equipped item,
+     * and zero total weight.
+     *
+     * @tparam Comparator The comparison class for querying items
+     */
+    Inventory();
+
+    /**
+     * @brief Retrieves the value stored in `equipped_`
+     * @return The Item pointer stored in `equipped_`
+     */
+    Item* getEquipped() const;
+
+    /**
+     * @brief Equips a new item.
+     * @param itemToEquip A pointer to the item to equip.
+     * @post Updates `equipped` to the specified item
+     * without deallocating the original.
+     */
+    void equip(Item* itemToEquip);
+
+    /**
+     * @brief Discards the currently equipped item.
+     * @post Deallocates the item pointed to by `equipped`
+     * and sets `equipped` to nullptr, if `equipped` is not nullptr already.
+     */
+    void discardEquipped();
+
+    /**
+     * @brief Retrieves the value stored in `weight_`
+     * @return The float value stored in `weight_`
+     */
+    float getWeight() const;
+
+    /**
+     * @brief Retrieves the value stored in `item_count_`
+     * @return The size_t value stored in `item_count_`
+     */
+    size_t size() const;
+
+    /**
+     * @brief Retrieves a copy of the container holding inventory items.
+     *
+     * @return Container of items in the inventory
+     */
+    ItemFlatSet getItems() const;
+
+    /**
+     * @brief Exposes a read-only view of the container holding inventory items.
+     *
+     * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+     * The view iterates in no particular order; its iterators stay valid until the inventory is modified.
+     *
+     * @return A const reference to the container of items in the inventory
+     */
+    const ItemFlatSet& items() const;
+
+    /**
+     * @brief Attempts to add a new item to the inventory.
+     *
+     * @param target Item to be added to the inventory
+     * @return true if the item was successfully added, false if an item
+     *         with the same name already exists
+     * @post Updates the weight_ member to reflect the new Item pickup
+     */
+    bool pickup(const Item& target);
+
+    /**
+     * @brief Attempts to add every item of a range to the inventory.
+     *
+     * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+     * @return The number of Items added; Items whose name is already in the
+     *         inventory, or earlier in the batch, are skipped like in pickup
+     * @post Updates the weight_ member to reflect the new Items
+     * @note Reserves slots for the whole batch up front, so the table grows at most once.
+     */
+    template <class Range>
+    size_t pickupBatch(const Range& batch);
+
+    /**
+     * @brief Attempts to remove an item from the inventory by name.
+     *
+     * @param name Name of the item to be removed
+     * @return true if the item was successfully removed, false if the
+     *         item was not found in the inventory
+     * @post Updates the weight_ member to reflect removing the Item
+     */
+    bool discard(const std::string& itemName);
+
+    /**
+     * @brief Checks if an item with the given name exists in the inventory.
+     *
+     * @param name Name of the item to search for
+     * @return true if the item exists in the inventory, false otherwise
+     */
+    bool contains(const std::string& itemName) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range.
+     *
+     * Returns a set of items that fall between the start and end items
+     * according to the specified Comparator (inclusive on both ends)
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @return std::unordered_set of items within the specified range
+     *
+     * @note Returns an empty set if the end item is less than the start item
+     * @example To select all Items with weights 0.4 to 10.9, we'd setup the class & parameters as such:
+     *  - this Inventory object is of type Inventory<CompareItemWeight>
+     *  - start = Item("some_name", 0.4, ItemType::None)
+     *  - end = = Item("some_other_name", 10.9, ItemType::None)
+     *
+     */
+    std::unordered_set<Item> query(const Item& start, const Item& end) const;
+
+    /**
+     * @brief Queries the inventory for items within a specified range,
+     * appending them to a caller-provided vector in sorted order.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     *
+     * @note Appends nothing if the end item is less than the start item
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
+    /**
+     * @brief Destructor for the Inventory class.
+     * @post Deallocates any dynamically allocated resources.
+     */
+    ~Inventory();
+};
+
+#include "FlatHashInventory.cpp"
\ No newline at end of file
@@ -82,6 +82,20 @@ Inventory<Comparator, std::unordered_set<Item>>::getItems() const
     return items_;
 }
 
+/**
+ * @brief Exposes a read-only view of the container holding inventory items.
+ *
+ * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+ * The view iterates in no particular order; its iterators stay valid until the inventory is modified.
+ *
+ * @return A const reference to the container of items in the inventory
+ */
+template <class Comparator>
+const std::unordered_set<Item>& Inventory<Comparator, std::unordered_set<Item>>::items() const
+{
+    return items_;
+}
+
 /**
  * @brief Attempts to add a new item to the inventory.
  *
@@ -93,17 +107,42 @@ Inventory<Comparator, std::unordered_set<Item>>::getItems() const
 template <class Comparator>
 bool Inventory<Comparator, std::unordered_set<Item>>::pickup(const Item& target)
 {
-    auto itr = std::find_if(items_.begin(), items_.end(),
-    [&](const Item& item) { return item.name_ == target.name_; });
-
-    if (itr == items_.end()) {
-        items_.insert(target);
+    if (items_.insert(target).second) {
         weight_ += target.weight_;
+        ordered_.markStale();
         return true;
     }
     return false;
 }
 
+/**
+ * @brief Attempts to add every item of a range to the inventory.
+ *
+ * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+ * @return The number of Items added; Items whose name is already in the
+ *         inventory, or earlier in the batch, are skipped like in pickup
+ * @post Updates the weight_ member to reflect the new Items
+ * @note Reserves bucket capacity for the whole batch up front, so the table rehashes at most once.
+ */
+template <class Comparator>
+template <class Range>
+size_t Inventory<Comparator, std::unordered_set<Item>>::pickupBatch(const Range& batch)
+{
+    items_.reserve(items_.size() + std::distance(std::begin(batch), std::end(batch)));
+
+    size_t added = 0;
+    for (const Item& target : batch) {
+        if (items_.insert(target).second) {
+            weight_ += target.weight_;
+            added++;
+        }
+    }
+    if (added) {
+        ordered_.markStale();
+    }
+    return added;
+}
+
 /**
  * @brief Attempts to remove an item from the inventory by name.
  *
@@ -125,11 +164,16 @@ bool Inventory<Comparator, std::unordered_set<Item>>::discard(
     // }
     // return false;
 
-    auto itr = items_.find(itemName);
+    const ItemName* key = findItemName(itemName);
+    if (key == nullptr) {
+        return false;
+    }
+    auto itr = items_.find(Item(*key));
 
     if (itr != items_.end()) {
         weight_ -= itr->weight_;
         items_.erase(itr);
+        ordered_.markStale();
         return true;
     }
     return false;
@@ -147,7 +191,8 @@ bool Inventory<Comparator, std::unordered_set<Item>>::contains(
 {
     // return std::find_if(items_.begin(), items_.end(),
     // [&](const Item& item) { return item.name_ == itemName; }) != items_.end();
-    return items_.find(itemName) != items_.end();
+    const ItemName* key = findItemName(itemName);
+    return key != nullptr && items_.find(Item(*key)) != items_.end();
 }
 
 /**
@@ -173,13 +218,31 @@ Inventory<Comparator, std::unordered_set<Item>>::query(const Item& start,
     const Item& end) const
 {
     std::unordered_set<Item> return_items_;
+    ordered_.visit(items_, start, end, [&return_items_](const Item& value) { return_items_.insert(value); });
+    return return_items_;
+}
 
-    for (const auto& value : items_) {
-        if (Comparator::leq(value, end) && !(Comparator::lessThan(value,start))) {
-            return_items_.insert(value);
-        }
+/**
+ * @brief Queries the inventory for items within a specified range,
+ * appending them to a caller-provided vector in sorted order.
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param result The vector to which matching Items are appended, in ascending order by Comparator
+ *
+ * @note Appends nothing if the end item is less than the start item
+ */
+template <class Comparator>
+void Inventory<Comparator, std::unordered_set<Item>>::query(const Item& start,
+    const Item& end, std::vector<Item>& result) const
+{
+    size_t first = result.size();
+    bool sorted = ordered_.visit(items_, start, end, [&result](const Item& value) { result.push_back(value); });
+    if (!sorted) {
+        // A scan found the matches in bucket order; sorting only them costs O(k log k)
+        std::sort(result.begin() + first, result.end(),
+            [](const Item& a, const Item& b) { return Comparator::lessThan(a, b); });
     }
-    return return_items_;
 }
 
 /**
@@ -1,13 +1,24 @@
 #pragma once
 
 #include "Inventory.hpp"
+#include "OrderedItemIndex.hpp"
+#include <iterator>
 #include <unordered_set>
+#include <vector>
 
 template <class Comparator>
 class Inventory<Comparator, std::unordered_set<Item>> {
 private:
     std::unordered_set<Item> items_;
 
+    /**
+     * `items_` sorted by Comparator, used to answer range queries by binary search.
+     * Elements of an unordered_set never move, so the index can point to them;
+     * every pickup & discard marks it stale, & queries scan `items_` until a run of
+     * them rebuilds it. Concurrent queries stay safe, as they were before the index.
+     */
+    mutable OrderedItemIndex<Comparator> ordered_;
+
 protected:
     // A pointer to a dynamically allocated Item outside of the Player's bag
     Item* equipped_;
@@ -66,6 +77,16 @@ public:
      */
     std::unordered_set<Item> getItems() const;
 
+    /**
+     * @brief Exposes a read-only view of the container holding inventory items.
+     *
+     * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+     * The view iterates in no particular order; its iterators stay valid until the inventory is modified.
+     *
+     * @return A const reference to the container of items in the inventory
+     */
+    const std::unordered_set<Item>& items() const;
+
     /**
      * @brief Attempts to add a new item to the inventory.
      *
@@ -76,6 +97,18 @@ public:
      */
     bool pickup(const Item& target);
 
+    /**
+     * @brief Attempts to add every item of a range to the inventory.
+     *
+     * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+     * @return The number of Items added; Items whose name is already in the
+     *         inventory, or earlier in the batch, are skipped like in pickup
+     * @post Updates the weight_ member to reflect the new Items
+     * @note Reserves bucket capacity for the whole batch up front, so the table rehashes at most once.
+     */
+    template <class Range>
+    size_t pickupBatch(const Range& batch);
+
     /**
      * @brief Attempts to remove an item from the inventory by name.
      *
@@ -113,6 +146,18 @@ public:
      */
     std::unordered_set<Item> query(const Item& start, const Item& end) const;
 
+    /**
+     * @brief Queries the inventory for items within a specified range,
+     * appending them to a caller-provided vector in sorted order.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     *
+     * @note Appends nothing if the end item is less than the start item
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
     /**
      * @brief Destructor for the Inventory class.
      * @post Deallocates any dynamically allocated resources.
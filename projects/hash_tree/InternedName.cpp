@@ -0,0 +1,218 @@
+#include "InternedName.hpp"
+#include <mutex>
+
+namespace {
+/**
+ * @brief Packs the first 8 bytes of a string big-endian, so that comparing
+ * two prefixes as integers orders them like comparing the bytes
+ */
+std::uint64_t packPrefix(const std::string& text)
+{
+    std::uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; i++) {
+        prefix <<= 8;
+        if (i < text.size()) {
+            prefix |= static_cast<unsigned char>(text[i]);
+        }
+    }
+    return prefix;
+}
+}
+
+// =========== NAME TABLE  ===========
+
+NameTable::NameTable()
+{
+    entries_.push_back({ "", std::hash<std::string> {}(""), 0, 0, InternedName(static_cast<const NameEntry*>(nullptr)) });
+    empty_ = &entries_.back();
+    entries_.back().handle_.entry_ = empty_;
+    lookup_.emplace(std::string_view(empty_->text_), empty_);
+}
+
+/**
+ * @brief Retrieves the table shared by every InternedName
+ */
+NameTable& NameTable::global()
+{
+    static NameTable table;
+    return table;
+}
+
+/**
+ * @brief Finds the entry for a name, creating it if the name has never been interned
+ *
+ * @param text The name to intern
+ * @return A pointer to the name's entry
+ */
+const NameEntry* NameTable::intern(const std::string& text)
+{
+    if (text.empty()) {
+        return empty_;
+    }
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto itr = lookup_.find(std::string_view(text));
+        if (itr != lookup_.end()) {
+            return itr->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto itr = lookup_.find(std::string_view(text)); // Another thread may have interned it since
+    if (itr != lookup_.end()) {
+        return itr->second;
+    }
+
+    entries_.push_back({ text, std::hash<std::string> {}(text), packPrefix(text),
+        static_cast<std::uint32_t>(entries_.size()), InternedName(static_cast<const NameEntry*>(nullptr)) });
+    NameEntry* entry = &entries_.back();
+    entry->handle_.entry_ = entry;
+    lookup_.emplace(std::string_view(entry->text_), entry);
+    return entry;
+}
+
+/**
+ * @brief Finds the handle for a name without interning it
+ *
+ * @param text The name to look up
+ * @return A pointer to the name's handle, or nullptr if the name has never been interned
+ */
+const InternedName* NameTable::find(const std::string& text)
+{
+    if (text.empty()) {
+        return &empty_->handle_;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto itr = lookup_.find(std::string_view(text));
+    return (itr == lookup_.end()) ? nullptr : &itr->second->handle_;
+}
+
+/**
+ * @brief Returns the number of distinct names interned so far, including the empty name
+ */
+size_t NameTable::size()
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return entries_.size();
+}
+
+// =========== INTERNED NAME  ===========
+
+/**
+ * @brief Constructs a handle to the given name, interning it if necessary
+ * @param text The name, default value of an empty string
+ */
+InternedName::InternedName(const std::string& text)
+    : entry_ { NameTable::global().intern(text) }
+{
+}
+
+InternedName::InternedName(const char* text)
+    : InternedName(std::string(text))
+{
+}
+
+InternedName::InternedName(const NameEntry* entry)
+    : entry_ { entry }
+{
+}
+
+/**
+ * @brief Retrieves the text of the name
+ */
+const std::string& InternedName::str() const
+{
+    return entry_->text_;
+}
+
+InternedName::operator const std::string&() const
+{
+    return entry_->text_;
+}
+
+/**
+ * @brief Retrieves the name's unique id
+ */
+std::uint32_t InternedName::id() const
+{
+    return entry_->id_;
+}
+
+/**
+ * @brief Retrieves the hash computed when the name was interned
+ */
+size_t InternedName::hash() const
+{
+    return entry_->hash_;
+}
+
+/**
+ * @brief Compares two names lexicographically, like std::string::compare
+ *
+ * @param rhs The name to compare against
+ * @return A negative value, 0 or a positive value if this name is less than, equal to or greater than rhs
+ */
+int InternedName::compare(const InternedName& rhs) const
+{
+    if (entry_ == rhs.entry_) {
+        return 0;
+    }
+    if (entry_->prefix_ != rhs.entry_->prefix_) {
+        return (entry_->prefix_ < rhs.entry_->prefix_) ? -1 : 1;
+    }
+    return entry_->text_.compare(rhs.entry_->text_);
+}
+
+bool InternedName::operator==(const InternedName& rhs) const
+{
+    return entry_ == rhs.entry_;
+}
+
+bool InternedName::operator!=(const InternedName& rhs) const
+{
+    return entry_ != rhs.entry_;
+}
+
+bool InternedName::operator<(const InternedName& rhs) const
+{
+    return compare(rhs) < 0;
+}
+
+bool operator==(const InternedName& lhs, const std::string& rhs)
+{
+    return lhs.entry_->text_ == rhs;
+}
+
+bool operator==(const std::string& lhs, const InternedName& rhs)
+{
+    return lhs == rhs.entry_->text_;
+}
+
+bool operator!=(const InternedName& lhs, const std::string& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool operator!=(const std::string& lhs, const InternedName& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Outputs the name's text to an output stream.
+ */
+std::ostream& operator<<(std::ostream& os, const InternedName& name)
+{
+    os << name.entry_->text_;
+    return os;
+}
+
+/**
+ * @brief Returns the hash computed when the name was interned
+ */
+size_t std::hash<InternedName>::operator()(const InternedName& name) const
+{
+    return name.hash();
+}
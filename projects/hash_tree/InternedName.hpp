@@ -0,0 +1,147 @@
+/**
+ * @file InternedName.hpp
+ * @brief Defines the global table of interned Item names & the InternedName handle to its entries
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct NameEntry;
+
+/**
+ * @class InternedName
+ * @brief A pointer-sized handle to an interned name
+ *
+ * Copying is a pointer copy, equality is a pointer comparison, hashing returns
+ * the hash computed at interning, & ordering compares the 8-byte prefixes as
+ * integers before falling back to comparing the full text.
+ *
+ * Converts implicitly to & from std::string so that it can stand in for one as Item::name_.
+ *
+ * @note Every name converted to an InternedName is interned. Lookups that should not
+ * grow the table go through NameTable::find (see findItemName in Item.hpp) instead.
+ */
+class InternedName {
+public:
+    /**
+     * @brief Constructs a handle to the given name, interning it if necessary
+     * @param text The name, default value of an empty string
+     */
+    InternedName(const std::string& text = "");
+    InternedName(const char* text);
+
+    /**
+     * @brief Retrieves the text of the name
+     */
+    const std::string& str() const;
+    operator const std::string&() const;
+
+    /**
+     * @brief Retrieves the name's unique id
+     */
+    std::uint32_t id() const;
+
+    /**
+     * @brief Retrieves the hash computed when the name was interned
+     */
+    size_t hash() const;
+
+    /**
+     * @brief Compares two names lexicographically, like std::string::compare
+     *
+     * @param rhs The name to compare against
+     * @return A negative value, 0 or a positive value if this name is less than, equal to or greater than rhs
+     */
+    int compare(const InternedName& rhs) const;
+
+    bool operator==(const InternedName& rhs) const;
+    bool operator!=(const InternedName& rhs) const;
+    bool operator<(const InternedName& rhs) const;
+
+    friend bool operator==(const InternedName& lhs, const std::string& rhs);
+    friend bool operator==(const std::string& lhs, const InternedName& rhs);
+    friend bool operator!=(const InternedName& lhs, const std::string& rhs);
+    friend bool operator!=(const std::string& lhs, const InternedName& rhs);
+
+    /**
+     * @brief Outputs the name's text to an output stream.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const InternedName& name);
+
+private:
+    friend class NameTable;
+    const NameEntry* entry_;
+
+    explicit InternedName(const NameEntry* entry);
+};
+
+/**
+ * @brief A single interned name, computed once when the name is first interned
+ */
+struct NameEntry {
+    std::string text_; // The name itself
+    size_t hash_; // std::hash<std::string> of text_
+    std::uint64_t prefix_; // The first 8 bytes of text_ packed big-endian, zero padded
+    std::uint32_t id_; // A unique, stable id, in order of interning
+    InternedName handle_; // A handle to this entry, so lookups can return one without copying
+};
+
+/**
+ * @class NameTable
+ * @brief Hands out one stable NameEntry per distinct name
+ *
+ * Entries are never freed or moved, so pointers to them stay valid for the
+ * lifetime of the program. Interning is thread-safe.
+ */
+class NameTable {
+public:
+    /**
+     * @brief Retrieves the table shared by every InternedName
+     */
+    static NameTable& global();
+
+    /**
+     * @brief Finds the entry for a name, creating it if the name has never been interned
+     *
+     * @param text The name to intern
+     * @return A pointer to the name's entry
+     */
+    const NameEntry* intern(const std::string& text);
+
+    /**
+     * @brief Finds the handle for a name without interning it
+     *
+     * @param text The name to look up
+     * @return A pointer to the name's handle, or nullptr if the name has never been interned
+     */
+    const InternedName* find(const std::string& text);
+
+    /**
+     * @brief Returns the number of distinct names interned so far, including the empty name
+     */
+    size_t size();
+
+private:
+    std::shared_mutex mutex_; // Shared for lookups, exclusive for inserting
+    std::deque<NameEntry> entries_;
+    std::unordered_map<std::string_view, const NameEntry*> lookup_; // Views into each entry's own text_
+    const NameEntry* empty_; // The entry for "", returned without locking
+
+    NameTable();
+};
+
+/**
+ * @brief Hash function for InternedName, returning the hash computed at interning
+ */
+template <>
+struct std::hash<InternedName> {
+    size_t operator()(const InternedName& name) const;
+};
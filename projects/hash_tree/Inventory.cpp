@@ -87,6 +87,20 @@ Inventory<Comparator, Container>::getItems() const
     return items_;
 }
 
+/**
+ * @brief Exposes a read-only view of the container holding inventory items.
+ *
+ * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+ * The view iterates in the Container's own order; its iterators stay valid until the inventory is modified.
+ *
+ * @return A const reference to the container of items in the inventory
+ */
+template <class Comparator, class Container>
+const Container& Inventory<Comparator, Container>::items() const
+{
+    return items_;
+}
+
 /**
  * @brief Attempts to add a new item to the inventory.
  *
@@ -105,6 +119,26 @@ bool Inventory<Comparator, Container>::pickup(const Item& target)
     return true;
 }
 
+/**
+ * @brief Attempts to add every item of a range to the inventory.
+ *
+ * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+ * @return The number of Items added; Items whose name is already in the
+ *         inventory, or earlier in the batch, are skipped like in pickup
+ * @post Updates the weight_ member to reflect the new Items
+ * @note Equivalent to calling pickup for every Item in order.
+ */
+template <class Comparator, class Container>
+template <class Range>
+size_t Inventory<Comparator, Container>::pickupBatch(const Range& batch)
+{
+    size_t added = 0;
+    for (const Item& target : batch) {
+        added += pickup(target);
+    }
+    return added;
+}
+
 /**
  * @brief Checks if an item with the given name exists in the inventory.
  *
@@ -83,6 +83,16 @@ public:
      */
     Container getItems() const;
 
+    /**
+     * @brief Exposes a read-only view of the container holding inventory items.
+     *
+     * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+     * The view iterates in the Container's own order; its iterators stay valid until the inventory is modified.
+     *
+     * @return A const reference to the container of items in the inventory
+     */
+    const Container& items() const;
+
     /**
      * @brief Attempts to add a new item to the inventory.
      *
@@ -92,6 +102,18 @@ public:
      */
     bool pickup(const Item& target);
 
+    /**
+     * @brief Attempts to add every item of a range to the inventory.
+     *
+     * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+     * @return The number of Items added; Items whose name is already in the
+     *         inventory, or earlier in the batch, are skipped like in pickup
+     * @post Updates the weight_ member to reflect the new Items
+     * @note Equivalent to calling pickup for every Item in order.
+     */
+    template <class Range>
+    size_t pickupBatch(const Range& batch);
+
     /**
      * @brief Attempts to remove an item from the inventory by name.
      *
@@ -0,0 +1,329 @@
+/**
+ * @file InventoryBenchmark.cpp
+ * @brief Drives every Inventory backend through the same seeded mixes of
+ * pickup, discard, contains & query operations, & reports for each:
+ *  - throughput, in operations per second
+ *  - latency percentiles over every operation, & the 99th percentile of each kind
+ *  - heap allocations per operation, & heap bytes per stored item after the initial fill,
+ *    tracked by replacing the global operator new & delete
+ *  - with INVENTORY_COUNTERS, the backends' internal counters (see InventoryCounters.hpp)
+ *
+ * Every backend starts from the same half-full inventory & replays the same operations.
+ * Each operation is timed on its own, so latencies include ~20-50 ns of clock overhead.
+ *
+ * Build & run with, for example:
+ *   g++ -std=c++17 -O2 InventoryBenchmark.cpp Item.cpp Compare.cpp ItemGenerator.cpp ItemFlatSet.cpp InventoryCounters.cpp -o inventory_benchmark
+ *   ./inventory_benchmark [item count] [operations] [mix] [seed]
+ * where mix weighs pickup/discard/contains/query, e.g. 10/10/70/10. Without one, every preset mix is run.
+ * Add -DINVENTORY_COUNTERS to report the internal counters too.
+ */
+
+#include "BTreeInventory.hpp"
+#include "Compare.hpp"
+#include "FlatHashInventory.hpp"
+#include "HashInventory.hpp"
+#include "InventoryCounters.hpp"
+#include "ItemGenerator.hpp"
+#include "TreeInventory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum OpKind { PICKUP = 0, DISCARD = 1, CONTAINS = 2, QUERY = 3 };
+const size_t KINDS = 4;
+const std::array<const char*, KINDS> KIND_NAMES = { "pickup", "discard", "contains", "query" };
+
+// Heap bytes currently allocated through operator new, & the number of allocations so far
+size_t live_bytes = 0;
+size_t allocations = 0;
+
+// Every allocation is prefixed by its size, keeping the default new alignment
+const size_t HEADER = alignof(std::max_align_t);
+
+/**
+ * @brief A named mix of operations, as relative weights per OpKind
+ */
+struct Mix {
+    std::string name_;
+    std::array<unsigned, KINDS> weights_;
+};
+
+const std::vector<Mix> PRESETS = {
+    { "read-heavy", { 5, 5, 80, 10 } },
+    { "write-heavy", { 45, 45, 10, 0 } },
+    { "query-heavy", { 10, 10, 20, 60 } },
+    { "balanced", { 25, 25, 25, 25 } },
+};
+
+/**
+ * @brief One operation to replay: its kind, & the item (or query range) it uses
+ */
+struct Op {
+    OpKind kind_;
+    size_t index_; // into the item pool, or the ranges for a QUERY
+};
+
+/**
+ * @brief The shared input of every backend's run
+ */
+struct Workload {
+    std::vector<Item> pool_; // every item an operation may pick up, discard or look up
+    size_t prefill_; // the first prefill_ items of the pool are picked up before timing
+    std::vector<std::pair<Item, Item>> ranges_; // query bounds, by weight
+    std::vector<Op> ops_;
+};
+
+/**
+ * @brief Parses a mix written as pickup/discard/contains/query weights, e.g. 10/10/70/10
+ * @throws std::invalid_argument If there aren't 4 weights, or they're all 0
+ */
+Mix parseMix(const std::string& text)
+{
+    Mix mix { text, {} };
+    std::stringstream stream(text);
+    std::string weight;
+    size_t kind = 0;
+    unsigned total = 0;
+    for (; kind < KINDS && std::getline(stream, weight, '/'); kind++) {
+        mix.weights_[kind] = std::stoul(weight);
+        total += mix.weights_[kind];
+    }
+    if (kind != KINDS || total == 0 || std::getline(stream, weight)) {
+        throw std::invalid_argument("mix must be pickup/discard/contains/query weights, e.g. 10/10/70/10");
+    }
+    return mix;
+}
+
+/**
+ * @brief Draws `count` operations following a mix
+ */
+std::vector<Op> generateOps(const Mix& mix, const size_t& count, const size_t& pool, const size_t& ranges, std::mt19937& rng)
+{
+    std::discrete_distribution<int> kind(mix.weights_.begin(), mix.weights_.end());
+    std::uniform_int_distribution<size_t> item(0, pool - 1);
+    std::uniform_int_distribution<size_t> range(0, ranges - 1);
+
+    std::vector<Op> ops;
+    ops.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        OpKind k = static_cast<OpKind>(kind(rng));
+        ops.push_back({ k, (k == QUERY) ? range(rng) : item(rng) });
+    }
+    return ops;
+}
+
+/**
+ * @brief Returns the p-th quantile of sorted latencies, or 0 if there are none
+ */
+double percentile(const std::vector<std::uint64_t>& sorted, const double& p)
+{
+    return sorted.empty() ? 0 : sorted[static_cast<size_t>(p * (sorted.size() - 1))];
+}
+
+/**
+ * @brief Runs a workload on a single backend & prints one row of results
+ *
+ * @param label The name of the backend
+ * @param workload The items, query ranges & operations to replay
+ */
+template <class Container>
+void run(const std::string& label, const Workload& workload)
+{
+    size_t before = live_bytes;
+    Inventory<CompareItemWeight, Container> inventory;
+    for (size_t i = 0; i < workload.prefill_; i++) {
+        inventory.pickup(workload.pool_[i]);
+    }
+    // The inventory copies every item it picks up, so everything allocated since `before` is its own
+    double bytes_per_item = inventory.size() ? double(live_bytes - before) / inventory.size() : 0;
+
+    std::array<std::vector<std::uint64_t>, KINDS> latencies;
+    for (auto& kind : latencies) {
+        kind.reserve(workload.ops_.size());
+    }
+    std::vector<Item> matching;
+    matching.reserve(workload.pool_.size());
+    size_t checksum = 0;
+
+#ifdef INVENTORY_COUNTERS
+    inventory_counters.reset();
+#endif
+    size_t allocations_before = allocations;
+    auto start = Clock::now();
+    for (const Op& op : workload.ops_) {
+        auto op_start = Clock::now();
+        switch (op.kind_) {
+        case PICKUP:
+            checksum += inventory.pickup(workload.pool_[op.index_]);
+            break;
+        case DISCARD:
+            checksum += inventory.discard(workload.pool_[op.index_].name_);
+            break;
+        case CONTAINS:
+            checksum += inventory.contains(workload.pool_[op.index_].name_);
+            break;
+        case QUERY:
+            matching.clear();
+            inventory.query(workload.ranges_[op.index_].first, workload.ranges_[op.index_].second, matching);
+            checksum += matching.size();
+            break;
+        }
+        latencies[op.kind_].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - op_start).count());
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    double allocs_per_op = double(allocations - allocations_before) / std::max<size_t>(1, workload.ops_.size());
+
+    std::vector<std::uint64_t> all;
+    all.reserve(workload.ops_.size());
+    for (auto& kind : latencies) {
+        std::sort(kind.begin(), kind.end());
+        all.insert(all.end(), kind.begin(), kind.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    std::cout << std::left << std::setw(11) << label << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << workload.ops_.size() / seconds
+              << std::setw(8) << percentile(all, 0.5) << std::setw(8) << percentile(all, 0.99)
+              << std::setw(9) << percentile(all, 0.999);
+    for (const auto& kind : latencies) {
+        std::cout << std::setw(10) << percentile(kind, 0.99);
+    }
+    std::cout << std::setprecision(2) << std::setw(10) << allocs_per_op << std::setprecision(1) << std::setw(9) << bytes_per_item;
+#ifdef INVENTORY_COUNTERS
+    size_t queries = latencies[QUERY].size();
+    std::cout << std::setprecision(2)
+              << std::setw(9) << double(inventory_counters.rotations_) / std::max<size_t>(1, workload.ops_.size())
+              << std::setw(9) << double(inventory_counters.probes_) / std::max<size_t>(1, inventory_counters.lookups_)
+              << std::setw(10) << std::setprecision(1) << double(inventory_counters.nodes_visited_) / std::max<size_t>(1, queries);
+#endif
+    std::cout << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+ * @brief Prints the header of a mix's table
+ */
+void printHeader(const Mix& mix)
+{
+    std::cout << std::endl << mix.name_ << " (pickup/discard/contains/query "
+              << mix.weights_[PICKUP] << "/" << mix.weights_[DISCARD] << "/"
+              << mix.weights_[CONTAINS] << "/" << mix.weights_[QUERY] << "), latencies in ns" << std::endl;
+    std::cout << std::left << std::setw(11) << "backend" << std::right
+              << std::setw(12) << "ops/s" << std::setw(8) << "p50" << std::setw(8) << "p99" << std::setw(9) << "p99.9";
+    for (const char* kind : KIND_NAMES) {
+        std::cout << std::setw(10) << (std::string(kind).substr(0, 5) + " p99");
+    }
+    std::cout << std::setw(10) << "allocs/op" << std::setw(9) << "B/item";
+#ifdef INVENTORY_COUNTERS
+    std::cout << std::setw(9) << "rot/op" << std::setw(9) << "probes" << std::setw(10) << "nodes/q";
+#endif
+    std::cout << std::endl;
+}
+
+}
+
+// The replacements are kept out of line: inlined into a container's deallocation path, GCC would
+// see a pointer from operator new reach free() (-Wmismatched-new-delete), & the size header read
+// before the object (-Warray-bounds), though every block here is both allocated & freed by malloc
+[[gnu::noinline]] void* operator new(size_t size)
+{
+    void* block = std::malloc(size + HEADER);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(block) = size;
+    live_bytes += size;
+    allocations++;
+    return static_cast<char*>(block) + HEADER;
+}
+
+[[gnu::noinline]] void operator delete(void* pointer) noexcept
+{
+    if (pointer != nullptr) {
+        void* block = static_cast<char*>(pointer) - HEADER;
+        live_bytes -= *static_cast<size_t*>(block);
+        std::free(block);
+    }
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+int main(int argc, char** argv)
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    const size_t operations = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 200000;
+    std::vector<Mix> mixes = PRESETS;
+    if (argc > 3) {
+        try {
+            mixes = { parseMix(argv[3]) };
+        } catch (const std::exception& e) {
+            std::cerr << "invalid mix " << argv[3] << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    const std::uint32_t seed = (argc > 4) ? std::strtoul(argv[4], nullptr, 10) : 1;
+    if (count == 0) {
+        std::cerr << "the item count must be positive" << std::endl;
+        return 1;
+    }
+
+    Workload workload;
+    ItemGenerator generator(seed);
+    workload.pool_.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        workload.pool_.push_back(generator.randomItem());
+    }
+    workload.prefill_ = count / 2;
+
+    // Narrow weight windows, like a UI filter
+    const size_t queries = 1000;
+    for (size_t i = 0; i < queries; i++) {
+        float low = generator.randomFloat(ItemGenerator::MIN_WEIGHT, ItemGenerator::MAX_WEIGHT);
+        workload.ranges_.push_back({ Item("", low), Item("", low + 0.5f) });
+    }
+
+    std::cout << count << " items (" << workload.prefill_ << " picked up before timing), "
+              << operations << " operations per mix, seed " << seed << std::endl;
+    std::mt19937 rng(seed);
+    for (const Mix& mix : mixes) {
+        workload.ops_ = generateOps(mix, operations, count, queries, rng);
+        printHeader(mix);
+        run<std::unordered_set<Item>>("hash", workload);
+        run<FlatHash>("flat hash", workload);
+        run<Tree>("tree", workload);
+        run<BTree>("b+tree", workload);
+    }
+    return 0;
+}
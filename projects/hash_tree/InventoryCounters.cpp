@@ -0,0 +1,13 @@
+#include "InventoryCounters.hpp"
+
+#ifdef INVENTORY_COUNTERS
+InventoryCounters inventory_counters {};
+#endif
+
+/**
+ * @brief Sets every counter to 0
+ */
+void InventoryCounters::reset()
+{
+    *this = InventoryCounters {};
+}
@@ -0,0 +1,35 @@
+/**
+ * @file InventoryCounters.hpp
+ * @brief Defines optional internal counters for the Inventory backends' data structures
+ *
+ * The counters are only compiled in with INVENTORY_COUNTERS; otherwise INVENTORY_COUNT()
+ * expands to nothing, so the instrumented code paths are exactly the uninstrumented ones.
+ * They are plain (non-atomic) globals, meant for single-threaded profiling runs such as
+ * InventoryBenchmark.cpp.
+ */
+
+#pragma once
+#include <cstddef>
+
+// Uncomment the following line (or compile with -DINVENTORY_COUNTERS) to count
+// the work done inside the backends, e.g. rotations & slots probed.
+// #define INVENTORY_COUNTERS
+
+struct InventoryCounters {
+    size_t rotations_; // single rotations performed by ItemAVL (a double rotation counts twice)
+    size_t lookups_; // name lookups in an ItemFlatSet
+    size_t probes_; // slots read by those lookups, so probes_ / lookups_ is the mean probe length
+    size_t nodes_visited_; // nodes visited by the tree & B+-tree inventories' range queries
+
+    /**
+     * @brief Sets every counter to 0
+     */
+    void reset();
+};
+
+#ifdef INVENTORY_COUNTERS
+extern InventoryCounters inventory_counters;
+#define INVENTORY_COUNT(counter, amount) (inventory_counters.counter += (amount))
+#else
+#define INVENTORY_COUNT(counter, amount) ((void)0)
+#endif
@@ -7,7 +7,7 @@
  * @param weight The weight of the item, default value of 0
  * @param type The type of the item, defualt value ItemType::None
  */
-Item::Item(const std::string& name, const float& weight, const ItemType& type)
+Item::Item(const ItemName& name, const float& weight, const ItemType& type)
     : name_ { name }
     , weight_ { weight }
     , type_ { type }
@@ -46,14 +46,31 @@ std::ostream& operator<<(std::ostream& os, const Item& item)
     return os;
 }
 
+/**
+ * @brief Looks up the ItemName for a name being searched for, without interning it
+ *
+ * @param name The name to look up
+ * @return A pointer to the ItemName, or nullptr if no Item can have that name.
+ * Without ITEM_INTERNED_NAMES this is always &name.
+ */
+const ItemName* findItemName(const std::string& name)
+{
+#ifdef ITEM_INTERNED_NAMES
+    return NameTable::global().find(name);
+#else
+    return &name;
+#endif
+}
+
 /**
  * @brief Computes a hash value for an Item based on
  * using the standard hash for strings on the Item's name
+ * (precomputed at interning when ITEM_INTERNED_NAMES is defined)
  *
  * @param i The Item to hash
  * @return Hash value for the Item
  */
 size_t std::hash<Item>::operator()(const Item& i) const
 {
-    return std::hash<std::string> {}(i.name_);
+    return std::hash<ItemName> {}(i.name_);
 }
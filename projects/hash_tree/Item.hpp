@@ -3,6 +3,18 @@
 #include <iostream>
 #include <string>
 
+// Uncomment the following line (or compile with -DITEM_INTERNED_NAMES) to store
+// Item names as InternedName handles into a global table. Copying, comparing for
+// equality & hashing a name then cost a pointer operation instead of a string one.
+// #define ITEM_INTERNED_NAMES
+
+#ifdef ITEM_INTERNED_NAMES
+#include "InternedName.hpp"
+using ItemName = InternedName;
+#else
+using ItemName = std::string;
+#endif
+
 enum ItemType {
     NONE = 0,
     WEAPON = 1,
@@ -11,7 +23,7 @@ enum ItemType {
 };
 
 struct Item {
-    std::string name_;
+    ItemName name_;
     float weight_;
     ItemType type_;
 
@@ -22,7 +34,7 @@ struct Item {
      * @param weight The weight of the item, default value of 0
      * @param type The type of the item, defualt value ItemType::None
      */
-    Item(const std::string& name = "", const float& weight = 0, const ItemType& type = NONE);
+    Item(const ItemName& name = "", const float& weight = 0, const ItemType& type = NONE);
 
     /**
      * @brief Compares two Items for equality based on their names.
@@ -50,6 +62,15 @@ struct Item {
     friend std::ostream& operator<<(std::ostream& os, const Item& item);
 };
 
+/**
+ * @brief Looks up the ItemName for a name being searched for, without interning it
+ *
+ * @param name The name to look up
+ * @return A pointer to the ItemName, or nullptr if no Item can have that name.
+ * Without ITEM_INTERNED_NAMES this is always &name.
+ */
+const ItemName* findItemName(const std::string& name);
+
 /**
  * @brief Hash function for Item to support use in
  *        unordered containers. Implements hashing
@@ -63,6 +84,7 @@ struct std::hash<Item> {
     /**
      * @brief Computes a hash value for an Item based on
      * using the standard hash for strings on the Item's name
+     * (precomputed at interning when ITEM_INTERNED_NAMES is defined)
      *
      * @param i The Item to hash
      * @return Hash value for the Item
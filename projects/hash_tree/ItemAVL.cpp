@@ -1,7 +1,78 @@
 #include "ItemAVL.hpp"
 
-template <class Comparator>
-const Node* ItemAVL<Comparator>::root() const
+/**
+ * @brief Default Constructor: Constructs the end iterator
+ */
+inline ItemAVLIterator::ItemAVLIterator()
+    : depth_ { 0 }
+{
+}
+
+/**
+ * @brief Constructs an iterator pointing to the smallest Item of a subtree
+ * @param root The root of the subtree to iterate over
+ */
+inline ItemAVLIterator::ItemAVLIterator(const Node* root)
+    : depth_ { 0 }
+{
+    pushLeft(root);
+}
+
+/**
+ * @brief Pushes a Node & its chain of left children onto the stack
+ * @param n The Node to start from
+ */
+inline void ItemAVLIterator::pushLeft(const Node* n)
+{
+    while (n) {
+        stack_[depth_++] = n;
+        n = n->left_;
+    }
+}
+
+inline ItemAVLIterator::reference ItemAVLIterator::operator*() const
+{
+    return stack_[depth_ - 1]->value_;
+}
+
+inline ItemAVLIterator::pointer ItemAVLIterator::operator->() const
+{
+    return &stack_[depth_ - 1]->value_;
+}
+
+/**
+ * @brief Advances to the next Item in-order
+ * @return A reference to the advanced iterator
+ */
+inline ItemAVLIterator& ItemAVLIterator::operator++()
+{
+    const Node* current = stack_[--depth_];
+    pushLeft(current->right_);
+    return *this;
+}
+
+inline ItemAVLIterator ItemAVLIterator::operator++(int)
+{
+    ItemAVLIterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+inline bool ItemAVLIterator::operator==(const ItemAVLIterator& rhs) const
+{
+    if (depth_ == 0 || rhs.depth_ == 0) {
+        return depth_ == rhs.depth_;
+    }
+    return stack_[depth_ - 1] == rhs.stack_[rhs.depth_ - 1];
+}
+
+inline bool ItemAVLIterator::operator!=(const ItemAVLIterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <class Comparator, class Allocator>
+const Node* ItemAVL<Comparator, Allocator>::root() const
 {
     return root_;
 }
@@ -12,8 +83,8 @@ const Node* ItemAVL<Comparator>::root() const
  * @param n A pointer to a node to be examined
  * @return The height of the given node, or -1 if given a nullptr
  */
-template <class Comparator>
-int ItemAVL<Comparator>::height(Node* n) const
+template <class Comparator, class Allocator>
+int ItemAVL<Comparator, Allocator>::height(Node* n) const
 {
     if (n == nullptr) {
         return -1;
@@ -24,17 +95,135 @@ int ItemAVL<Comparator>::height(Node* n) const
 /**
  * @brief Returns the size of the AVL tree
  */
-template <class Comparator>
-int ItemAVL<Comparator>::size() const
+template <class Comparator, class Allocator>
+int ItemAVL<Comparator, Allocator>::size() const
 {
     return size_;
 }
 
+/**
+ * @brief Returns an iterator to the smallest Item by Comparator
+ */
+template <class Comparator, class Allocator>
+typename ItemAVL<Comparator, Allocator>::const_iterator ItemAVL<Comparator, Allocator>::begin() const
+{
+    return const_iterator(root_);
+}
+
+/**
+ * @brief Returns the iterator one past the largest Item by Comparator
+ */
+template <class Comparator, class Allocator>
+typename ItemAVL<Comparator, Allocator>::const_iterator ItemAVL<Comparator, Allocator>::end() const
+{
+    return const_iterator();
+}
+
+/**
+ * @brief Determines the number of Nodes in the subtree rooted at a given Node
+ *
+ * @param n A pointer to a node to be examined
+ * @return The subtree size of the given node, or 0 if given a nullptr
+ */
+template <class Comparator, class Allocator>
+int ItemAVL<Comparator, Allocator>::subtreeSize(const Node* n) const
+{
+    if (n == nullptr) {
+        return 0;
+    }
+    return n->size_;
+}
+
+/**
+ * @brief Counts the Items of the longest in-order prefix satisfying a predicate
+ *
+ * @param inPrefix A predicate that holds for every Item up to some point
+ *  of the in-order traversal & for none after it
+ * @return The number of Items for which inPrefix holds, in O(log n)
+ */
+template <class Comparator, class Allocator>
+template <class Predicate>
+size_t ItemAVL<Comparator, Allocator>::countPrefix(Predicate inPrefix) const
+{
+    size_t count = 0;
+    const Node* t = root_;
+    while (t) {
+        if (inPrefix(t->value_)) {
+            // t & its whole left subtree are in the prefix
+            count += subtreeSize(t->left_) + 1;
+            t = t->right_;
+        } else {
+            t = t->left_;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Counts the Items ordered strictly before a given Item by Comparator
+ *
+ * @param item An Item whose compared property is to be ranked
+ * @return The number of Items that are less than item, in O(log n)
+ */
+template <class Comparator, class Allocator>
+size_t ItemAVL<Comparator, Allocator>::rank(const Item& item) const
+{
+    return countPrefix([&item](const Item& i) { return Comparator::lessThan(i, item); });
+}
+
+/**
+ * @brief Retrieves the Item at a given position of the in-order traversal
+ *
+ * @param k The 0-based position, where 0 is the smallest Item by Comparator
+ * @return A const reference to the k-th smallest Item, found in O(log n)
+ * @throws std::out_of_range If k is not less than size()
+ */
+template <class Comparator, class Allocator>
+const Item& ItemAVL<Comparator, Allocator>::select(const size_t& k) const
+{
+    if (k >= static_cast<size_t>(size_)) {
+        throw std::out_of_range("Position out of range");
+    }
+
+    size_t remaining = k;
+    const Node* t = root_;
+    while (true) {
+        size_t left = subtreeSize(t->left_);
+        if (remaining < left) {
+            t = t->left_;
+        } else if (remaining == left) {
+            return t->value_;
+        } else {
+            remaining -= left + 1;
+            t = t->right_;
+        }
+    }
+}
+
+/**
+ * @brief Counts the Items within a specified range according to
+ * the Comparator (inclusive on both ends), without visiting them
+ *
+ * @param start An Item whose compared property is the lower bound of the range
+ * @param end An Item whose compared property is the upper bound of the range
+ * @return The number of Items in [start, end], in O(log n), or 0 if end is less than start
+ */
+template <class Comparator, class Allocator>
+size_t ItemAVL<Comparator, Allocator>::countRange(const Item& start, const Item& end) const
+{
+    if (!Comparator::leq(start, end)) {
+        return 0;
+    }
+    size_t atMostEnd = countPrefix([&end](const Item& i) { return Comparator::leq(i, end); });
+    size_t beforeStart = countPrefix([&start](const Item& i) { return !Comparator::leq(start, i); });
+    return atMostEnd - beforeStart;
+}
+
 /**
  * @brief Prints the value of the specified Node t and its children using level-order traversal
  */
-template <class Comparator>
-void ItemAVL<Comparator>::displayLevelOrder(Node* t) const
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::displayLevelOrder(Node* t) const
 {
     if (!t) {
         return;
@@ -63,8 +252,8 @@ void ItemAVL<Comparator>::displayLevelOrder(Node* t) const
 /**
  * @brief Prints the level-order traversal of the specified subtree
  */
-template <class Comparator>
-void ItemAVL<Comparator>::displayLevelOrder() const
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::displayLevelOrder() const
 {
     displayLevelOrder(root_);
 }
@@ -72,8 +261,8 @@ void ItemAVL<Comparator>::displayLevelOrder() const
 /**
  * @brief Wrapper for printing the unique file sizes of the ItemAVL in-order
  */
-template <class Comparator>
-void ItemAVL<Comparator>::displayInOrder() const
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::displayInOrder() const
 {
     if (!root_) {
         return;
@@ -86,8 +275,8 @@ void ItemAVL<Comparator>::displayInOrder() const
  * @brief Helper for displayInOrder(). Prints the unique file sizes in-order given a specified root
  * @param root The root of the tree to be printed
  */
-template <class Comparator>
-void ItemAVL<Comparator>::displayInOrder(Node* root) const
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::displayInOrder(Node* root) const
 {
     if (!root) {
         return;
@@ -101,8 +290,8 @@ void ItemAVL<Comparator>::displayInOrder(Node* root) const
 /**
  * @brief Default Constructor: Construct a new ItemAVL object
  */
-template <class Comparator>
-ItemAVL<Comparator>::ItemAVL()
+template <class Comparator, class Allocator>
+ItemAVL<Comparator, Allocator>::ItemAVL()
     : root_ { nullptr }
     , size_ { 0 }
 {
@@ -113,60 +302,223 @@ ItemAVL<Comparator>::ItemAVL()
  *
  * @param t The node to be deleted
  */
-template <class Comparator>
-void ItemAVL<Comparator>::deleteTree(Node*& t)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::deleteTree(Node*& t)
 {
     if (t == nullptr) {
         return;
     }
     deleteTree(t->left_);
     deleteTree(t->right_);
-    delete t;
+    allocator_.destroy(t);
     t = nullptr;
 }
 
 /**
- * @brief Destroy the ItemAVL, deallocating all necessary Nodes
+ * @brief Removes every Item from the tree
+ * @post The tree is empty & the allocator has released all of its memory
  */
-template <class Comparator>
-ItemAVL<Comparator>::~ItemAVL()
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::clear()
 {
     deleteTree(root_);
+    allocator_.release();
+    name_index_.clear();
+    size_ = 0;
 }
 
 /**
- * @brief Checks if the tree contains an item with a given name
- * @param name The name to check for
- * @return True if a matching Item exists, false otherwise.
+ * @brief Deep copies the given subtree, indexing every new Node by name
+ *
+ * @param t The root of the subtree to be copied
+ * @return The root of the copy, or nullptr if given a nullptr
  */
-template <class Comparator>
-bool ItemAVL<Comparator>::contains(const std::string& target) const
+template <class Comparator, class Allocator>
+Node* ItemAVL<Comparator, Allocator>::clone(const Node* t)
 {
-    return contains(target, root());
+    if (t == nullptr) {
+        return nullptr;
+    }
+    Node* copy = allocator_.create(t->value_, clone(t->left_), clone(t->right_));
+    copy->height_ = t->height_;
+    copy->size_ = t->size_;
+    name_index_[copy->value_.name_] = copy;
+    return copy;
 }
 
 /**
- * @brief Internal routine to check if a subtree contains an item with a given name
+ * @brief Copy Constructor: Deep copies every Node of rhs
+ * and rebuilds the name index to point at the new Nodes
  *
- * @param name The name to check for
- * @param subroot The root of the subtree to be searched
- * @return True if a matching Item exists, false otherwise.
+ * @param rhs The ItemAVL to copy
  */
-template <class Comparator>
-bool ItemAVL<Comparator>::contains(const std::string& target, const Node* subroot) const
+template <class Comparator, class Allocator>
+ItemAVL<Comparator, Allocator>::ItemAVL(const ItemAVL& rhs)
+    : root_ { nullptr }
+    , size_ { rhs.size_ }
 {
-    // if not node, false
-    if (subroot) {
-        if (subroot->value_.name_ == target) {
-            return true; // found
+    name_index_.reserve(rhs.name_index_.size());
+    root_ = clone(rhs.root_);
+}
+
+/**
+ * @brief Copy Assignment: Replaces the contents of this tree with a deep copy of rhs
+ *
+ * @param rhs The ItemAVL to copy
+ * @return A reference to the updated ItemAVL
+ */
+template <class Comparator, class Allocator>
+ItemAVL<Comparator, Allocator>& ItemAVL<Comparator, Allocator>::operator=(const ItemAVL& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        name_index_.reserve(rhs.name_index_.size());
+        root_ = clone(rhs.root_);
+        size_ = rhs.size_;
+    }
+    return *this;
+}
+
+/**
+ * @brief Range Constructor: Bulk-loads the Items of [first, last) into a perfectly balanced tree
+ *
+ * @param first An input iterator to the first Item to load
+ * @param last The input iterator one past the last Item to load
+ * @see assign
+ */
+template <class Comparator, class Allocator>
+template <class InputIt>
+ItemAVL<Comparator, Allocator>::ItemAVL(InputIt first, InputIt last)
+    : root_ { nullptr }
+    , size_ { 0 }
+{
+    assign(first, last);
+}
+
+/**
+ * @brief Replaces the contents of the tree with the Items of [first, last)
+ *
+ * The Items are sorted once by the tree's ordering & the tree is built bottom-up,
+ * perfectly balanced, without any rotations: O(n log n) in total, or O(n) if the
+ * Items are already sorted. Like repeated insert, only the first Item with a given name is kept.
+ *
+ * @param first An input iterator to the first Item to load
+ * @param last The input iterator one past the last Item to load
+ * @post The tree holds exactly the loaded Items
+ */
+template <class Comparator, class Allocator>
+template <class InputIt>
+void ItemAVL<Comparator, Allocator>::assign(InputIt first, InputIt last)
+{
+    clear();
+
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                      typename std::iterator_traits<InputIt>::iterator_category>) {
+        name_index_.reserve(std::distance(first, last));
+    }
+
+    // Drop repeated names, keeping a pointer to each name's index entry so that
+    // build can fill it in without hashing the name again
+    std::vector<IndexedItem> sorted;
+    for (; first != last; ++first) {
+        auto inserted = name_index_.emplace(first->name_, nullptr);
+        if (inserted.second) {
+            sorted.push_back({ *first, &inserted.first->second });
         }
+    }
+
+    auto byItem = [](const IndexedItem& a, const IndexedItem& b) { return precedes(a.first, b.first); };
+    if (!std::is_sorted(sorted.begin(), sorted.end(), byItem)) {
+        std::sort(sorted.begin(), sorted.end(), byItem);
+    }
+    root_ = build(sorted, 0, sorted.size());
+    size_ = static_cast<int>(sorted.size());
+}
+
+/**
+ * @brief Builds a perfectly balanced subtree from a sorted slice of Items, indexing every new Node by name
+ *
+ * @param sorted Items in strictly increasing order by precedes, each with its name's (empty)
+ *  index entry; the Items in the slice are moved from
+ * @param lo The index of the first Item of the slice
+ * @param hi The index one past the last Item of the slice
+ * @return The root of the new subtree, or nullptr if the slice is empty
+ */
+template <class Comparator, class Allocator>
+Node* ItemAVL<Comparator, Allocator>::build(std::vector<IndexedItem>& sorted, size_t lo, size_t hi)
+{
+    if (lo == hi) {
+        return nullptr;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    Node* left = build(sorted, lo, mid);
+    Node* right = build(sorted, mid + 1, hi);
+
+    Node* subroot = allocator_.create(std::move(sorted[mid].first), left, right);
+    subroot->height_ = 1 + std::max(height(left), height(right));
+    subroot->size_ = static_cast<int>(hi - lo);
+    *sorted[mid].second = subroot;
+    return subroot;
+}
+
+/**
+ * @brief Destroy the ItemAVL, deallocating all necessary Nodes
+ */
+template <class Comparator, class Allocator>
+ItemAVL<Comparator, Allocator>::~ItemAVL()
+{
+    clear();
+}
+
+/**
+ * @brief The strict ordering of the tree: Items are ordered by Comparator,
+ * and Items the Comparator considers equivalent are ordered by name.
+ *
+ * @param a First item to compare
+ * @param b Second item to compare
+ * @return true if a is ordered before b
+ */
+template <class Comparator, class Allocator>
+bool ItemAVL<Comparator, Allocator>::precedes(const Item& a, const Item& b)
+{
+    if (Comparator::lessThan(a, b)) {
+        return true;
+    }
+    if (Comparator::lessThan(b, a)) {
+        return false;
+    }
+    return a.name_ < b.name_;
+}
 
-        // check left and right
-        return contains(target, subroot->left_) || contains(target, subroot->right_);
+/**
+ * @brief Checks if the tree contains an item with a given name
+ * @param name The name to check for
+ * @return True if a matching Item exists, false otherwise.
+ */
+template <class Comparator, class Allocator>
+bool ItemAVL<Comparator, Allocator>::contains(const std::string& target) const
+{
+    const ItemName* key = findItemName(target);
+    return key != nullptr && name_index_.find(*key) != name_index_.end();
+}
 
+/**
+ * @brief Finds the item with a given name
+ * @param name The name to search for
+ * @return A const pointer to the matching Item, or nullptr if none exists
+ */
+template <class Comparator, class Allocator>
+const Item* ItemAVL<Comparator, Allocator>::find(const std::string& target) const
+{
+    const ItemName* key = findItemName(target);
+    if (key == nullptr) {
+        return nullptr;
+    }
+    auto itr = name_index_.find(*key);
+    if (itr == name_index_.end()) {
+        return nullptr;
     }
-    return false; // not found
-    
+    return &itr->second->value_;
 }
 
 /**
@@ -176,10 +528,10 @@ bool ItemAVL<Comparator>::contains(const std::string& target, const Node* subroo
  * @param target The Item to insert
  * @return True if the Item was successfully inserted, false otherwise.
  */
-template <class Comparator>
-bool ItemAVL<Comparator>::insert(const Item& target)
+template <class Comparator, class Allocator>
+bool ItemAVL<Comparator, Allocator>::insert(const Item& target)
 {
-    if (contains(target.name_)) {
+    if (name_index_.find(target.name_) != name_index_.end()) {
         return false;
     }
     insert(target, root_);
@@ -194,15 +546,16 @@ bool ItemAVL<Comparator>::insert(const Item& target)
  * @param subroot The root of the subtree to be inserted into
  * @post Set the new root of the subtree
  */
-template <class Comparator>
-void ItemAVL<Comparator>::insert(const Item& target, Node*& subroot)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::insert(const Item& target, Node*& subroot)
 {
     if (subroot == nullptr) {
-        subroot = new Node({ target });
+        subroot = allocator_.create(target);
+        name_index_[target.name_] = subroot;
         return;
     }
 
-    if (Comparator::lessThan(target, subroot->value_)) {
+    if (precedes(target, subroot->value_)) {
         insert(target, subroot->left_);
     } else {
         insert(target, subroot->right_);
@@ -217,61 +570,99 @@ void ItemAVL<Comparator>::insert(const Item& target, Node*& subroot)
  * @param name The name of the item to delete
  * @return The weight of the Item if it was successfully deleted, 0 otherwise.
  */
-template <class Comparator>
-float ItemAVL<Comparator>::erase(const std::string& target)
+template <class Comparator, class Allocator>
+float ItemAVL<Comparator, Allocator>::erase(const std::string& target)
 {
-    float erased_weight = erase(target, root_);
+    float erased_weight = 0;
+    erase(target, erased_weight);
+    return erased_weight;
+}
 
-    if (erased_weight) {
-        size_--;
+/**
+ * @brief Erases the item whose name matches the target name
+ *
+ * @param name The name of the item to delete
+ * @param erased_weight Set to the weight of the erased Item, if any
+ * @return True if an Item was erased, false if none matched (unlike the weight, even for a weightless Item)
+ */
+template <class Comparator, class Allocator>
+bool ItemAVL<Comparator, Allocator>::erase(const std::string& target, float& erased_weight)
+{
+    const ItemName* key = findItemName(target);
+    if (key == nullptr) {
+        return false;
     }
-    return erased_weight;
+    auto itr = name_index_.find(*key);
+    if (itr == name_index_.end()) {
+        return false;
+    }
+
+    Node* toDelete = itr->second;
+    erased_weight = toDelete->value_.weight_;
+    name_index_.erase(itr);
+
+    erase(toDelete, root_);
+    size_--;
+    return true;
 }
 
 /**
  * @brief Internal routes for deletion in a subtree
  *
- * @param itemName The name of the item to delete
- * @param subroot The root of the subtree of which to search for the item to be deleted
- * @return The weight of the item if deleted. Otherwise, 0.
- * @post Set the new root of the subtree
+ * @param target The Node to delete, which must exist within the subtree
+ * @param subroot The root of the subtree of which to search for the Node to be deleted
+ * @post Set the new root of the subtree, rebalancing every Node along the path
  */
-template <class Comparator>
-float ItemAVL<Comparator>::erase(const std::string& target, Node*& subroot)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::erase(const Node* target, Node*& subroot)
 {
     if (subroot == nullptr) {
-        return 0;
+        return;
     }
 
-    if (subroot->value_.name_ != target) {
-        float erased_weight = erase(target, subroot->left_);
-        if (erased_weight) {
-            return erased_weight;
+    if (subroot != target) {
+        if (precedes(target->value_, subroot->value_)) {
+            erase(target, subroot->left_);
+        } else {
+            erase(target, subroot->right_);
         }
-        erased_weight = erase(target, subroot->right_);
-        return erased_weight;
+        balance(subroot);
+        return;
     }
 
-    auto findMin = [](Node* subroot) {
-        while (subroot && subroot->left_) {
-            subroot = subroot->left_;
-        }
-        return subroot;
-    };
-
+    Node* toDelete = subroot;
     if (subroot->left_ && subroot->right_) {
-        // Two children
-        std::swap(subroot->value_, findMin(subroot->right_)->value_);
-        return erase(target, subroot->right_);
+        // Two children: the in-order successor Node takes the deleted Node's place
+        Node* successor = detachMin(subroot->right_);
+        successor->left_ = subroot->left_;
+        successor->right_ = subroot->right_;
+        subroot = successor;
+    } else {
+        subroot = (subroot->left_) ? subroot->left_ : subroot->right_;
     }
-    Node* toDelete = subroot;
-    float erased_weight = subroot->value_.weight_;
-    subroot = (subroot->left_) ? subroot->left_ : subroot->right_;
-    delete toDelete;
-    toDelete = nullptr;
+    allocator_.destroy(toDelete);
 
     balance(subroot);
-    return erased_weight;
+}
+
+/**
+ * @brief Unlinks the Node with the smallest Item from a subtree
+ *
+ * @param subroot The root of the subtree, which must not be empty
+ * @return The unlinked Node, whose children are left unchanged
+ * @post Set the new root of the subtree, rebalancing every Node along the path
+ */
+template <class Comparator, class Allocator>
+Node* ItemAVL<Comparator, Allocator>::detachMin(Node*& subroot)
+{
+    if (subroot->left_ == nullptr) {
+        Node* min = subroot;
+        subroot = subroot->right_;
+        return min;
+    }
+    Node* min = detachMin(subroot->left_);
+    balance(subroot);
+    return min;
 }
 
 /**
@@ -279,8 +670,8 @@ float ItemAVL<Comparator>::erase(const std::string& target, Node*& subroot)
  *
  * @param t The Node to be balanced
  */
-template <class Comparator>
-void ItemAVL<Comparator>::balance(Node*& t)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::balance(Node*& t)
 {
     if (t == nullptr) {
         return;
@@ -303,6 +694,7 @@ void ItemAVL<Comparator>::balance(Node*& t)
     }
 
     t->height_ = std::max(height(t->left_), height(t->right_)) + 1;
+    t->size_ = subtreeSize(t->left_) + subtreeSize(t->right_) + 1;
 }
 
 /**
@@ -312,15 +704,18 @@ void ItemAVL<Comparator>::balance(Node*& t)
  * @post k2 is set to the rotated root (ie. its initial left child);
  * Both nodes roots are updated to reflect the rotation
  */
-template <class Comparator>
-void ItemAVL<Comparator>::rotateWithLeftChild(Node*& k2)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::rotateWithLeftChild(Node*& k2)
 {
+    INVENTORY_COUNT(rotations_, 1);
     Node* k1 = k2->left_;
     k2->left_ = k1->right_;
     k1->right_ = k2;
 
     k2->height_ = std::max(height(k2->left_), height(k2->right_)) + 1;
     k1->height_ = std::max(height(k1->left_), k2->height_) + 1;
+    k2->size_ = subtreeSize(k2->left_) + subtreeSize(k2->right_) + 1;
+    k1->size_ = subtreeSize(k1->left_) + k2->size_ + 1;
     k2 = k1;
 }
 
@@ -331,14 +726,17 @@ void ItemAVL<Comparator>::rotateWithLeftChild(Node*& k2)
  * @post k1 is set to the rotated root (ie. its initial right child);
  * Both nodes roots are updated to reflect the rotation
  */
-template <class Comparator>
-void ItemAVL<Comparator>::rotateWithRightChild(Node*& k1)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::rotateWithRightChild(Node*& k1)
 {
+    INVENTORY_COUNT(rotations_, 1);
     Node* k2 = k1->right_;
     k1->right_ = k2->left_;
     k2->left_ = k1;
     k1->height_ = 1 + std::max(height(k1->left_), height(k1->right_));
     k2->height_ = 1 + std::max(k1->height_, height(k2->right_));
+    k1->size_ = 1 + subtreeSize(k1->left_) + subtreeSize(k1->right_);
+    k2->size_ = 1 + k1->size_ + subtreeSize(k2->right_);
     k1 = k2;
 }
 
@@ -348,8 +746,8 @@ void ItemAVL<Comparator>::rotateWithRightChild(Node*& k1)
  * @param k3 The parent Node with a left-right imbalance
  * @post Updates heights, sets new root
  */
-template <class Comparator>
-void ItemAVL<Comparator>::doubleWithLeftChild(Node*& k3)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::doubleWithLeftChild(Node*& k3)
 {
     rotateWithRightChild(k3->left_);
     rotateWithLeftChild(k3);
@@ -361,8 +759,8 @@ void ItemAVL<Comparator>::doubleWithLeftChild(Node*& k3)
  * @param k3 The parent Node with a right-left imbalance
  * @post Updates heights, sets new root
  */
-template <class Comparator>
-void ItemAVL<Comparator>::doubleWithRightChild(Node*& k3)
+template <class Comparator, class Allocator>
+void ItemAVL<Comparator, Allocator>::doubleWithRightChild(Node*& k3)
 {
     rotateWithLeftChild(k3->right_);
     rotateWithRightChild(k3);
@@ -10,34 +10,144 @@
 #include <vector>
 
 #include "Compare.hpp"
+#include "InventoryCounters.hpp"
 #include "Item.hpp"
+#include "NodeAllocator.hpp"
+#include <cstddef>
 #include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 
 struct Node {
     Item value_;
     int height_; // The height of the Node
+    int size_; // The number of Nodes in the subtree rooted at this Node
     Node* left_; // A pointer to Node's left child
     Node* right_; // A pointer to Node's right child
 
     // Parameterized constructor for a Node
     Node(Item i, Node* lt = nullptr, Node* rt = nullptr)
-        : value_ { i }
+        : value_ { std::move(i) }
         , height_ { 0 }
+        , size_ { 1 }
         , left_ { lt }
         , right_ { rt }
     {
     }
 };
 
-template <class Comparator = CompareItemName>
+/**
+ * @class ItemAVLIterator
+ * @brief A read-only, in-order iterator over the Items of an ItemAVL
+ *
+ * Keeps the path of Nodes still to be visited on a fixed-size stack,
+ * so iterating never recurses or allocates. 64 entries is well above the
+ * height of any AVL tree with fewer than 2^31 Nodes (~1.44 log2 n).
+ *
+ * @note Like the iterators of the STL containers, it is invalidated by
+ * inserting into or erasing from the tree.
+ */
+class ItemAVLIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Item;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Item*;
+    using reference = const Item&;
+
+    /**
+     * @brief Default Constructor: Constructs the end iterator
+     */
+    ItemAVLIterator();
+
+    /**
+     * @brief Constructs an iterator pointing to the smallest Item of a subtree
+     * @param root The root of the subtree to iterate over
+     */
+    explicit ItemAVLIterator(const Node* root);
+
+    reference operator*() const;
+    pointer operator->() const;
+
+    /**
+     * @brief Advances to the next Item in-order
+     * @return A reference to the advanced iterator
+     */
+    ItemAVLIterator& operator++();
+    ItemAVLIterator operator++(int);
+
+    bool operator==(const ItemAVLIterator& rhs) const;
+    bool operator!=(const ItemAVLIterator& rhs) const;
+
+private:
+    static constexpr int MAX_DEPTH = 64;
+    const Node* stack_[MAX_DEPTH]; // The current Node on top, then the ancestors still to be visited
+    int depth_; // The number of Nodes on the stack, 0 at the end
+
+    /**
+     * @brief Pushes a Node & its chain of left children onto the stack
+     * @param n The Node to start from
+     */
+    void pushLeft(const Node* n);
+};
+
+/**
+ * @tparam Comparator The comparison class ordering the tree's Items
+ * @tparam Allocator The allocation policy (see NodeAllocator.hpp) used to create & destroy Nodes.
+ *  Defaults to a PoolAllocator, which recycles erased Nodes & frees the whole tree by slab.
+ */
+template <class Comparator = CompareItemName, class Allocator = PoolAllocator<Node>>
 class ItemAVL {
 public:
+    using const_iterator = ItemAVLIterator;
+
     /**
      * @brief Default Constructor: Construct a new AVLtree object
      */
     ItemAVL();
 
+    /**
+     * @brief Copy Constructor: Deep copies every Node of rhs
+     * and rebuilds the name index to point at the new Nodes
+     *
+     * @param rhs The ItemAVL to copy
+     */
+    ItemAVL(const ItemAVL& rhs);
+
+    /**
+     * @brief Copy Assignment: Replaces the contents of this tree with a deep copy of rhs
+     *
+     * @param rhs The ItemAVL to copy
+     * @return A reference to the updated ItemAVL
+     */
+    ItemAVL& operator=(const ItemAVL& rhs);
+
+    /**
+     * @brief Range Constructor: Bulk-loads the Items of [first, last) into a perfectly balanced tree
+     *
+     * @param first An input iterator to the first Item to load
+     * @param last The input iterator one past the last Item to load
+     * @see assign
+     */
+    template <class InputIt>
+    ItemAVL(InputIt first, InputIt last);
+
+    /**
+     * @brief Replaces the contents of the tree with the Items of [first, last)
+     *
+     * The Items are sorted once by the tree's ordering & the tree is built bottom-up,
+     * perfectly balanced, without any rotations: O(n log n) in total, or O(n) if the
+     * Items are already sorted. Like repeated insert, only the first Item with a given name is kept.
+     *
+     * @param first An input iterator to the first Item to load
+     * @param last The input iterator one past the last Item to load
+     * @post The tree holds exactly the loaded Items
+     */
+    template <class InputIt>
+    void assign(InputIt first, InputIt last);
+
     /**
      * @brief Destroy the AVLtree, deallocating all necessary Nodes
      */
@@ -57,6 +167,8 @@ public:
      *
      * @param target The Item to insert
      * @return True if the Item was successfully inserted, false otherwise.
+     * @note The duplicate check is an O(1) expected lookup in the name index,
+     * so the whole insertion is O(log n).
      */
     bool insert(const Item& target);
 
@@ -65,16 +177,41 @@ public:
      *
      * @param name The name of the item to delete
      * @return The weight of the Item if it was successfully deleted, 0 otherwise.
+     * @note The Node is located through the name index, then reached from the root
+     * in O(log n) by descending with the tree's ordering.
      */
     float erase(const std::string& name);
 
+    /**
+     * @brief Erases the item whose name matches the target name
+     *
+     * @param name The name of the item to delete
+     * @param erased_weight Set to the weight of the erased Item, if any
+     * @return True if an Item was erased, false if none matched (unlike the weight, even for a weightless Item)
+     */
+    bool erase(const std::string& name, float& erased_weight);
+
+    /**
+     * @brief Removes every Item from the tree
+     * @post The tree is empty & the allocator has released all of its memory
+     */
+    void clear();
+
     /**
      * @brief Checks if the tree contains an item with a given name
      * @param name The name to check for
      * @return True if a matching Item exists, false otherwise.
+     * @note O(1) expected, using the name index.
      */
     bool contains(const std::string& name) const;
 
+    /**
+     * @brief Finds the item with a given name
+     * @param name The name to search for
+     * @return A const pointer to the matching Item, or nullptr if none exists
+     */
+    const Item* find(const std::string& name) const;
+
     /**
      * @brief Determines the height of a given Node
      *
@@ -98,19 +235,107 @@ public:
      */
     int size() const;
 
+    /**
+     * @brief Returns an iterator to the smallest Item by Comparator
+     * @note Iterating from begin() to end() visits every Item in-order without allocating
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns the iterator one past the largest Item by Comparator
+     */
+    const_iterator end() const;
+
+    // =========== ORDER STATISTICS  ===========
+
+    /**
+     * @brief Counts the Items ordered strictly before a given Item by Comparator
+     *
+     * @param item An Item whose compared property is to be ranked
+     * @return The number of Items that are less than item, in O(log n)
+     * @example In an ItemAVL<CompareItemWeight>, rank(Item("", 2.5)) is the number of Items lighter than 2.5
+     */
+    size_t rank(const Item& item) const;
+
+    /**
+     * @brief Retrieves the Item at a given position of the in-order traversal
+     *
+     * @param k The 0-based position, where 0 is the smallest Item by Comparator
+     * @return A const reference to the k-th smallest Item, found in O(log n)
+     * @throws std::out_of_range If k is not less than size()
+     * @example The k-th heaviest Item of an ItemAVL<CompareItemWeight> is select(size() - 1 - k)
+     */
+    const Item& select(const size_t& k) const;
+
+    /**
+     * @brief Counts the Items within a specified range according to
+     * the Comparator (inclusive on both ends), without visiting them
+     *
+     * @param start An Item whose compared property is the lower bound of the range
+     * @param end An Item whose compared property is the upper bound of the range
+     * @return The number of Items in [start, end], in O(log n), or 0 if end is less than start
+     */
+    size_t countRange(const Item& start, const Item& end) const;
+
 private:
     static const int ALLOWED_IMBALANCE = 1;
     Node* root_;
     int size_;
 
+    // Creates & destroys every Node of this tree
+    Allocator allocator_;
+
+    /**
+     * Maps every Item name to the Node holding it.
+     * Nodes keep their Item for as long as they live (rotations & deletions relink
+     * Nodes rather than moving values between them), so entries only change
+     * on insertion and erasure.
+     */
+    std::unordered_map<ItemName, Node*> name_index_;
+
+    // An Item waiting to be bulk-loaded, with the index entry its Node will be stored in
+    using IndexedItem = std::pair<Item, Node**>;
+
     /**
-     * @brief Internal routine to check if a subtree contains an item with a given name
+     * @brief The strict ordering of the tree: Items are ordered by Comparator,
+     * and Items the Comparator considers equivalent are ordered by name.
      *
-     * @param name The name to check for
-     * @param subroot The root of the subtree to be searched
-     * @return True if a matching Item exists, false otherwise.
+     * Since names are unique, this lets any stored Item be found by descending from the root.
+     *
+     * @param a First item to compare
+     * @param b Second item to compare
+     * @return true if a is ordered before b
      */
-    bool contains(const std::string& name, const Node* subroot) const;
+    static bool precedes(const Item& a, const Item& b);
+
+    /**
+     * @brief Determines the number of Nodes in the subtree rooted at a given Node
+     *
+     * @param n A pointer to a node to be examined
+     * @return The subtree size of the given node, or 0 if given a nullptr
+     */
+    int subtreeSize(const Node* n) const;
+
+    /**
+     * @brief Counts the Items of the longest in-order prefix satisfying a predicate
+     *
+     * @param inPrefix A predicate that holds for every Item up to some point
+     *  of the in-order traversal & for none after it
+     * @return The number of Items for which inPrefix holds, in O(log n)
+     */
+    template <class Predicate>
+    size_t countPrefix(Predicate inPrefix) const;
+
+    /**
+     * @brief Builds a perfectly balanced subtree from a sorted slice of Items, indexing every new Node by name
+     *
+     * @param sorted Items in strictly increasing order by precedes, each with its name's (empty)
+     *  index entry; the Items in the slice are moved from
+     * @param lo The index of the first Item of the slice
+     * @param hi The index one past the last Item of the slice
+     * @return The root of the new subtree, or nullptr if the slice is empty
+     */
+    Node* build(std::vector<IndexedItem>& sorted, size_t lo, size_t hi);
 
     /**
      * @brief Internal routine to insert into a subtree
@@ -124,12 +349,20 @@ private:
     /**
      * @brief Internal routes for deletion in a subtree
      *
-     * @param itemName The name of the item to delete
-     * @param subroot The root of the subtree of which to search for the item to be deleted
-     * @return The weight of the item if deleted. Otherwise, 0.
-     * @post Set the new root of the subtree
+     * @param target The Node to delete, which must exist within the subtree
+     * @param subroot The root of the subtree of which to search for the Node to be deleted
+     * @post Set the new root of the subtree, rebalancing every Node along the path
+     */
+    void erase(const Node* target, Node*& subroot);
+
+    /**
+     * @brief Unlinks the Node with the smallest Item from a subtree
+     *
+     * @param subroot The root of the subtree, which must not be empty
+     * @return The unlinked Node, whose children are left unchanged
+     * @post Set the new root of the subtree, rebalancing every Node along the path
      */
-    float erase(const std::string& itemName, Node*& subroot);
+    Node* detachMin(Node*& subroot);
 
     /**
      * @brief Balance the given Node
@@ -189,6 +422,14 @@ private:
      * @param t The node to be deleted
      */
     void deleteTree(Node*& t);
+
+    /**
+     * @brief Deep copies the given subtree, indexing every new Node by name
+     *
+     * @param t The root of the subtree to be copied
+     * @return The root of the copy, or nullptr if given a nullptr
+     */
+    Node* clone(const Node* t);
 };
 
 #include "ItemAVL.cpp"
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+ * @file ItemAVLBenchmark.cpp
+ * @brief Compares the Node allocation policies of ItemAVL on insert-heavy & mixed workloads
+ *
+ * Build & run with, for example:
+ *   g++ -std=c++17 -O2 ItemAVLBenchmark.cpp Item.cpp Compare.cpp ItemGenerator.cpp -o avl_benchmark
+ *   ./avl_benchmark [item count] [seed]
+ */
+
+#include "Compare.hpp"
+#include "ItemAVL.hpp"
+#include "ItemGenerator.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Returns the milliseconds elapsed since start
+ */
+double elapsedMs(const Clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Inserts every item into an empty tree, then destroys the tree
+ *
+ * @param items The items to insert
+ * @return The time taken in ms, including destruction
+ */
+template <class Tree>
+double insertHeavy(const std::vector<Item>& items)
+{
+    auto start = Clock::now();
+    {
+        Tree tree;
+        for (const Item& item : items) {
+            tree.insert(item);
+        }
+    }
+    return elapsedMs(start);
+}
+
+/**
+ * @brief Fills a tree with half of the items, then performs `ops` random
+ * pickups & discards of items drawn from the whole set
+ *
+ * @param items The pool of items to draw from
+ * @param ops The number of insert/erase operations to perform
+ * @param seed The seed used to draw items & operations
+ * @return The time taken in ms, including destruction
+ */
+template <class Tree>
+double mixed(const std::vector<Item>& items, const size_t& ops, const std::uint32_t& seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, items.size() - 1);
+
+    auto start = Clock::now();
+    {
+        Tree tree;
+        for (size_t i = 0; i < items.size() / 2; i++) {
+            tree.insert(items[i]);
+        }
+        for (size_t i = 0; i < ops; i++) {
+            const Item& item = items[pick(rng)];
+            if (rng() & 1) {
+                tree.insert(item);
+            } else {
+                tree.erase(item.name_);
+            }
+        }
+    }
+    return elapsedMs(start);
+}
+
+/**
+ * @brief Runs both workloads for a given Comparator with the pool & heap policies
+ */
+template <class Comparator>
+void compare(const std::string& label, const std::vector<Item>& items, const std::uint32_t& seed)
+{
+    using Pooled = ItemAVL<Comparator, PoolAllocator<Node>>;
+    using Heap = ItemAVL<Comparator, HeapAllocator<Node>>;
+    const size_t ops = items.size() * 2;
+
+    std::cout << label << std::endl;
+    std::cout << "  insert-heavy  pool: " << insertHeavy<Pooled>(items) << " ms"
+              << "  new/delete: " << insertHeavy<Heap>(items) << " ms" << std::endl;
+    std::cout << "  mixed         pool: " << mixed<Pooled>(items, ops, seed) << " ms"
+              << "  new/delete: " << mixed<Heap>(items, ops, seed) << " ms" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const std::uint32_t seed = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1;
+
+    ItemGenerator generator(seed);
+    std::vector<Item> items;
+    items.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        items.push_back(generator.randomItem());
+    }
+
+    std::cout << count << " items, seed " << seed << std::endl;
+    compare<CompareItemName>("CompareItemName", items, seed);
+    compare<CompareItemWeight>("CompareItemWeight", items, seed);
+    compare<CompareItemType>("CompareItemType", items, seed);
+    return 0;
+}
@@ -0,0 +1,538 @@
+#include "ItemBTree.hpp"
+
+// =========== ITERATION  ===========
+
+template <class Comparator>
+ItemBTree<Comparator>::const_iterator::const_iterator(const BTreeNode* leaf, size_t index)
+    : leaf_ { leaf }
+    , index_ { index }
+{
+}
+
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator::reference ItemBTree<Comparator>::const_iterator::operator*() const
+{
+    return leaf_->keys_[index_];
+}
+
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator::pointer ItemBTree<Comparator>::const_iterator::operator->() const
+{
+    return &leaf_->keys_[index_];
+}
+
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator& ItemBTree<Comparator>::const_iterator::operator++()
+{
+    if (++index_ == leaf_->keys_.size()) {
+        leaf_ = leaf_->next_;
+        index_ = 0;
+    }
+    return *this;
+}
+
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator ItemBTree<Comparator>::const_iterator::operator++(int)
+{
+    const_iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+template <class Comparator>
+bool ItemBTree<Comparator>::const_iterator::operator==(const const_iterator& rhs) const
+{
+    return leaf_ == rhs.leaf_ && index_ == rhs.index_;
+}
+
+template <class Comparator>
+bool ItemBTree<Comparator>::const_iterator::operator!=(const const_iterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+/**
+ * @brief Returns an iterator to the smallest Item by Comparator
+ */
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator ItemBTree<Comparator>::begin() const
+{
+    const BTreeNode* t = root_;
+    while (t && !t->leaf_) {
+        t = t->children_.front();
+    }
+    return const_iterator(t, 0);
+}
+
+/**
+ * @brief Returns the iterator one past the largest Item by Comparator
+ */
+template <class Comparator>
+typename ItemBTree<Comparator>::const_iterator ItemBTree<Comparator>::end() const
+{
+    return const_iterator();
+}
+
+// =========== CONSTRUCTION & DESTRUCTION  ===========
+
+/**
+ * @brief Default Constructor: Construct a new, empty ItemBTree
+ */
+template <class Comparator>
+ItemBTree<Comparator>::ItemBTree()
+    : root_ { nullptr }
+    , size_ { 0 }
+{
+}
+
+/**
+ * @brief Copy Constructor: Deep copies every Node of rhs & relinks the copied leaves
+ *
+ * @param rhs The ItemBTree to copy
+ */
+template <class Comparator>
+ItemBTree<Comparator>::ItemBTree(const ItemBTree& rhs)
+    : root_ { nullptr }
+    , size_ { rhs.size_ }
+    , name_index_ { rhs.name_index_ }
+{
+    BTreeNode* last_leaf = nullptr;
+    if (rhs.root_) {
+        root_ = clone(rhs.root_, last_leaf);
+    }
+}
+
+/**
+ * @brief Copy Assignment: Replaces the contents of this tree with a deep copy of rhs
+ *
+ * @param rhs The ItemBTree to copy
+ * @return A reference to the updated ItemBTree
+ */
+template <class Comparator>
+ItemBTree<Comparator>& ItemBTree<Comparator>::operator=(const ItemBTree& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        BTreeNode* last_leaf = nullptr;
+        if (rhs.root_) {
+            root_ = clone(rhs.root_, last_leaf);
+        }
+        size_ = rhs.size_;
+        name_index_ = rhs.name_index_;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destroy the ItemBTree, deallocating every Node
+ */
+template <class Comparator>
+ItemBTree<Comparator>::~ItemBTree()
+{
+    deleteTree(root_);
+}
+
+/**
+ * @brief Deep copies the given subtree, linking each copied leaf after last_leaf
+ *
+ * @param t The root of the subtree to be copied
+ * @param last_leaf The most recently copied leaf, updated as leaves are copied
+ * @return The root of the copy
+ */
+template <class Comparator>
+BTreeNode* ItemBTree<Comparator>::clone(const BTreeNode* t, BTreeNode*& last_leaf)
+{
+    BTreeNode* copy = createNode(t->leaf_);
+    copy->keys_ = t->keys_;
+
+    if (t->leaf_) {
+        copy->prev_ = last_leaf;
+        if (last_leaf) {
+            last_leaf->next_ = copy;
+        }
+        last_leaf = copy;
+        return copy;
+    }
+
+    for (const BTreeNode* child : t->children_) {
+        copy->children_.push_back(clone(child, last_leaf));
+    }
+    return copy;
+}
+
+/**
+ * @brief Destroys the given Node and its children
+ *
+ * @param t The node to be deleted
+ */
+template <class Comparator>
+void ItemBTree<Comparator>::deleteTree(BTreeNode*& t)
+{
+    if (t == nullptr) {
+        return;
+    }
+    for (BTreeNode*& child : t->children_) {
+        deleteTree(child);
+    }
+    delete t;
+    t = nullptr;
+}
+
+/**
+ * @brief Removes every Item from the tree
+ */
+template <class Comparator>
+void ItemBTree<Comparator>::clear()
+{
+    deleteTree(root_);
+    name_index_.clear();
+    size_ = 0;
+}
+
+/**
+ * @brief Creates an empty Node, reserving room for a full Node's contents
+ *
+ * @param leaf Whether the Node is a leaf
+ * @return A pointer to the new Node
+ */
+template <class Comparator>
+BTreeNode* ItemBTree<Comparator>::createNode(bool leaf)
+{
+    BTreeNode* node = new BTreeNode(leaf);
+    // One extra slot, since a Node briefly overflows before it splits
+    if (leaf) {
+        node->keys_.reserve(LEAF_CAPACITY + 1);
+    } else {
+        node->keys_.reserve(INTERNAL_CAPACITY);
+        node->children_.reserve(INTERNAL_CAPACITY + 1);
+    }
+    return node;
+}
+
+// =========== LOOKUP  ===========
+
+/**
+ * @brief The strict ordering of the tree: Items are ordered by Comparator,
+ * and Items the Comparator considers equivalent are ordered by name.
+ *
+ * @param a First item to compare
+ * @param b Second item to compare
+ * @return true if a is ordered before b
+ */
+template <class Comparator>
+bool ItemBTree<Comparator>::precedes(const Item& a, const Item& b)
+{
+    if (Comparator::lessThan(a, b)) {
+        return true;
+    }
+    if (Comparator::lessThan(b, a)) {
+        return false;
+    }
+    return a.name_ < b.name_;
+}
+
+/**
+ * @brief Determines which child of an internal Node a key belongs to
+ *
+ * @param node The internal Node to search
+ * @param target The key to locate
+ * @return The index of the child whose subtree would hold target
+ */
+template <class Comparator>
+size_t ItemBTree<Comparator>::childIndex(const BTreeNode* node, const Item& target)
+{
+    // A key equal to a separator belongs to the right of it
+    return std::upper_bound(node->keys_.begin(), node->keys_.end(), target, precedes) - node->keys_.begin();
+}
+
+/**
+ * @brief Checks if the tree contains an item with a given name
+ * @param name The name to check for
+ * @return True if a matching Item exists, false otherwise.
+ */
+template <class Comparator>
+bool ItemBTree<Comparator>::contains(const std::string& name) const
+{
+    const ItemName* key = findItemName(name);
+    return key != nullptr && name_index_.find(*key) != name_index_.end();
+}
+
+/**
+ * @brief Returns the number of Items in the tree
+ */
+template <class Comparator>
+size_t ItemBTree<Comparator>::size() const
+{
+    return size_;
+}
+
+/**
+ * @brief Invokes a callback on every Item within a specified range according to
+ * the Comparator (inclusive on both ends), in sorted order
+ *
+ * @param start An Item whose compared property is the lower bound of the range
+ * @param end An Item whose compared property is the upper bound of the range
+ * @param visit A callable invoked with a const Item& for every matching Item
+ */
+template <class Comparator>
+template <class Visitor>
+void ItemBTree<Comparator>::forEachInRange(const Item& start, const Item& end, Visitor visit) const
+{
+    if (!root_ || !Comparator::leq(start, end)) {
+        return;
+    }
+
+    // Items below start form a prefix of the sorted order; skip past it
+    auto belowStart = [&start](const Item& i) { return !Comparator::leq(start, i); };
+
+    const BTreeNode* t = root_;
+    while (!t->leaf_) {
+        INVENTORY_COUNT(nodes_visited_, 1);
+        size_t i = std::partition_point(t->keys_.begin(), t->keys_.end(), belowStart) - t->keys_.begin();
+        t = t->children_[i];
+    }
+    size_t i = std::partition_point(t->keys_.begin(), t->keys_.end(), belowStart) - t->keys_.begin();
+
+    for (; t; t = t->next_, i = 0) {
+        INVENTORY_COUNT(nodes_visited_, 1);
+        for (; i < t->keys_.size(); i++) {
+            if (!Comparator::leq(t->keys_[i], end)) {
+                return;
+            }
+            visit(t->keys_[i]);
+        }
+    }
+}
+
+// =========== INSERTION  ===========
+
+/**
+ * @brief Inserts an item to the tree, if there are no items
+ * whose name equals the name of the item to insert
+ *
+ * @param target The Item to insert
+ * @return True if the Item was successfully inserted, false otherwise.
+ */
+template <class Comparator>
+bool ItemBTree<Comparator>::insert(const Item& target)
+{
+    if (!name_index_.emplace(target.name_, std::make_pair(target.weight_, target.type_)).second) {
+        return false;
+    }
+
+    if (!root_) {
+        root_ = createNode(true);
+    }
+
+    Item separator;
+    BTreeNode* right = nullptr;
+    if (insert(root_, target, separator, right)) {
+        // The root split, so the tree grows by one level
+        BTreeNode* new_root = createNode(false);
+        new_root->keys_.push_back(std::move(separator));
+        new_root->children_.push_back(root_);
+        new_root->children_.push_back(right);
+        root_ = new_root;
+    }
+    size_++;
+    return true;
+}
+
+/**
+ * @brief Internal routine to insert into a subtree
+ *
+ * @param node The root of the subtree to be inserted into
+ * @param target The Item to insert
+ * @param separator Set to the smallest key of the new right sibling, if node splits
+ * @param right Set to the new right sibling, if node splits
+ * @return True if node overflowed & was split in two, false otherwise
+ */
+template <class Comparator>
+bool ItemBTree<Comparator>::insert(BTreeNode* node, const Item& target, Item& separator, BTreeNode*& right)
+{
+    if (node->leaf_) {
+        auto position = std::upper_bound(node->keys_.begin(), node->keys_.end(), target, precedes);
+        node->keys_.insert(position, target);
+        if (node->keys_.size() <= LEAF_CAPACITY) {
+            return false;
+        }
+
+        // Split the leaf in half & link the new right half after it
+        size_t mid = node->keys_.size() / 2;
+        right = createNode(true);
+        std::move(node->keys_.begin() + mid, node->keys_.end(), std::back_inserter(right->keys_));
+        node->keys_.erase(node->keys_.begin() + mid, node->keys_.end());
+
+        right->next_ = node->next_;
+        right->prev_ = node;
+        if (node->next_) {
+            node->next_->prev_ = right;
+        }
+        node->next_ = right;
+
+        separator = right->keys_.front();
+        return true;
+    }
+
+    size_t i = childIndex(node, target);
+    Item child_separator;
+    BTreeNode* child_right = nullptr;
+    if (!insert(node->children_[i], target, child_separator, child_right)) {
+        return false;
+    }
+
+    node->keys_.insert(node->keys_.begin() + i, std::move(child_separator));
+    node->children_.insert(node->children_.begin() + i + 1, child_right);
+    if (node->children_.size() <= INTERNAL_CAPACITY) {
+        return false;
+    }
+
+    // Split the internal Node, moving its middle separator up to the parent
+    size_t mid = node->keys_.size() / 2;
+    right = createNode(false);
+    separator = std::move(node->keys_[mid]);
+    std::move(node->keys_.begin() + mid + 1, node->keys_.end(), std::back_inserter(right->keys_));
+    right->children_.assign(node->children_.begin() + mid + 1, node->children_.end());
+    node->keys_.erase(node->keys_.begin() + mid, node->keys_.end());
+    node->children_.erase(node->children_.begin() + mid + 1, node->children_.end());
+    return true;
+}
+
+// =========== ERASURE  ===========
+
+/**
+ * @brief Erases the item whose name matches the target name
+ *
+ * @param name The name of the item to delete
+ * @param erased_weight Set to the weight of the erased Item, if any
+ * @return True if an Item was erased, false if none matched
+ */
+template <class Comparator>
+bool ItemBTree<Comparator>::erase(const std::string& name, float& erased_weight)
+{
+    const ItemName* key = findItemName(name);
+    if (key == nullptr) {
+        return false;
+    }
+    auto itr = name_index_.find(*key);
+    if (itr == name_index_.end()) {
+        return false;
+    }
+
+    Item target(itr->first, itr->second.first, itr->second.second);
+    erased_weight = target.weight_;
+    name_index_.erase(itr);
+
+    erase(root_, target);
+    size_--;
+
+    if (!root_->leaf_ && root_->children_.size() == 1) {
+        // The root's only child becomes the root, so the tree shrinks by one level
+        BTreeNode* old_root = root_;
+        root_ = root_->children_.front();
+        delete old_root;
+    } else if (root_->leaf_ && root_->keys_.empty()) {
+        deleteTree(root_);
+    }
+    return true;
+}
+
+/**
+ * @brief Internal routine to erase from a subtree
+ *
+ * @param node The root of the subtree to be erased from
+ * @param target The key of the Item to erase, which must exist within the subtree
+ * @post Every Node below node along the path holds at least the minimum number of entries
+ */
+template <class Comparator>
+void ItemBTree<Comparator>::erase(BTreeNode* node, const Item& target)
+{
+    if (node->leaf_) {
+        auto position = std::lower_bound(node->keys_.begin(), node->keys_.end(), target, precedes);
+        if (position != node->keys_.end() && position->name_ == target.name_) {
+            node->keys_.erase(position);
+        }
+        return;
+    }
+
+    size_t i = childIndex(node, target);
+    BTreeNode* child = node->children_[i];
+    erase(child, target);
+
+    size_t occupancy = child->leaf_ ? child->keys_.size() : child->children_.size();
+    size_t minimum = child->leaf_ ? LEAF_MINIMUM : INTERNAL_MINIMUM;
+    if (occupancy < minimum) {
+        rebalance(node, i);
+    }
+}
+
+/**
+ * @brief Restores the minimum occupancy of an underfull child,
+ * by borrowing from a sibling or merging with one
+ *
+ * @param parent The internal Node whose child is underfull
+ * @param i The index of the underfull child
+ */
+template <class Comparator>
+void ItemBTree<Comparator>::rebalance(BTreeNode* parent, const size_t& i)
+{
+    BTreeNode* child = parent->children_[i];
+    BTreeNode* left = (i > 0) ? parent->children_[i - 1] : nullptr;
+    BTreeNode* right = (i + 1 < parent->children_.size()) ? parent->children_[i + 1] : nullptr;
+
+    if (child->leaf_) {
+        if (left && left->keys_.size() > LEAF_MINIMUM) {
+            child->keys_.insert(child->keys_.begin(), std::move(left->keys_.back()));
+            left->keys_.pop_back();
+            parent->keys_[i - 1] = child->keys_.front();
+        } else if (right && right->keys_.size() > LEAF_MINIMUM) {
+            child->keys_.push_back(std::move(right->keys_.front()));
+            right->keys_.erase(right->keys_.begin());
+            parent->keys_[i] = right->keys_.front();
+        } else {
+            // Merge the child with a sibling, removing the right one of the pair
+            size_t left_index = left ? i - 1 : i;
+            BTreeNode* into = parent->children_[left_index];
+            BTreeNode* from = parent->children_[left_index + 1];
+
+            std::move(from->keys_.begin(), from->keys_.end(), std::back_inserter(into->keys_));
+            into->next_ = from->next_;
+            if (from->next_) {
+                from->next_->prev_ = into;
+            }
+            delete from;
+            parent->keys_.erase(parent->keys_.begin() + left_index);
+            parent->children_.erase(parent->children_.begin() + left_index + 1);
+        }
+        return;
+    }
+
+    if (left && left->children_.size() > INTERNAL_MINIMUM) {
+        // Rotate the left sibling's last child through the parent
+        child->keys_.insert(child->keys_.begin(), std::move(parent->keys_[i - 1]));
+        child->children_.insert(child->children_.begin(), left->children_.back());
+        parent->keys_[i - 1] = std::move(left->keys_.back());
+        left->keys_.pop_back();
+        left->children_.pop_back();
+    } else if (right && right->children_.size() > INTERNAL_MINIMUM) {
+        // Rotate the right sibling's first child through the parent
+        child->keys_.push_back(std::move(parent->keys_[i]));
+        child->children_.push_back(right->children_.front());
+        parent->keys_[i] = std::move(right->keys_.front());
+        right->keys_.erase(right->keys_.begin());
+        right->children_.erase(right->children_.begin());
+    } else {
+        // Merge the child with a sibling, pulling their separator down between them
+        size_t left_index = left ? i - 1 : i;
+        BTreeNode* into = parent->children_[left_index];
+        BTreeNode* from = parent->children_[left_index + 1];
+
+        into->keys_.push_back(std::move(parent->keys_[left_index]));
+        std::move(from->keys_.begin(), from->keys_.end(), std::back_inserter(into->keys_));
+        into->children_.insert(into->children_.end(), from->children_.begin(), from->children_.end());
+        from->children_.clear();
+        delete from;
+        parent->keys_.erase(parent->keys_.begin() + left_index);
+        parent->children_.erase(parent->children_.begin() + left_index + 1);
+    }
+}
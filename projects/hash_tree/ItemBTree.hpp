@@ -0,0 +1,254 @@
+/**
+ * @file ItemBTree.hpp
+ * @brief Defines the interface for the ItemBTree class & implementation of the BTreeNode struct
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Compare.hpp"
+#include "InventoryCounters.hpp"
+#include "Item.hpp"
+
+struct BTreeNode {
+    bool leaf_; // Whether the Node is a leaf
+
+    /**
+     * In a leaf: the Items stored in the leaf, in sorted order.
+     * In an internal Node: the separators, where keys_[i] is the smallest Item
+     * of the subtree children_[i + 1] at the time it was split or rebalanced.
+     */
+    std::vector<Item> keys_;
+    std::vector<BTreeNode*> children_; // The children of an internal Node, one more than keys_
+
+    BTreeNode* prev_; // The previous leaf in sorted order, if a leaf
+    BTreeNode* next_; // The next leaf in sorted order, if a leaf
+
+    // Parameterized constructor for a BTreeNode
+    BTreeNode(bool leaf)
+        : leaf_ { leaf }
+        , prev_ { nullptr }
+        , next_ { nullptr }
+    {
+    }
+};
+
+/**
+ * @class ItemBTree
+ * @brief A B+-tree of Items, with many Items laid out contiguously per Node
+ * & every leaf linked to its neighbours
+ *
+ * Lookups touch about log_64(n) Nodes instead of log_2(n), & a range query walks
+ * along the leaves, reading consecutive Items from each.
+ *
+ * Like ItemAVL, Items the Comparator considers equivalent are ordered by name, &
+ * a name index provides O(1) expected contains() & lets erase() find its target.
+ *
+ * @tparam Comparator The comparison class ordering the tree's Items
+ */
+template <class Comparator = CompareItemName>
+class ItemBTree {
+public:
+    /**
+     * @class const_iterator
+     * @brief A read-only, in-order iterator that walks the linked leaves
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Item*;
+        using reference = const Item&;
+
+        const_iterator(const BTreeNode* leaf = nullptr, size_t index = 0);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& rhs) const;
+        bool operator!=(const const_iterator& rhs) const;
+
+    private:
+        const BTreeNode* leaf_; // The current leaf, or nullptr at the end
+        size_t index_; // The position within the current leaf
+    };
+
+    /**
+     * @brief Default Constructor: Construct a new, empty ItemBTree
+     */
+    ItemBTree();
+
+    /**
+     * @brief Copy Constructor: Deep copies every Node of rhs & relinks the copied leaves
+     *
+     * @param rhs The ItemBTree to copy
+     */
+    ItemBTree(const ItemBTree& rhs);
+
+    /**
+     * @brief Copy Assignment: Replaces the contents of this tree with a deep copy of rhs
+     *
+     * @param rhs The ItemBTree to copy
+     * @return A reference to the updated ItemBTree
+     */
+    ItemBTree& operator=(const ItemBTree& rhs);
+
+    /**
+     * @brief Destroy the ItemBTree, deallocating every Node
+     */
+    ~ItemBTree();
+
+    /**
+     * @brief Inserts an item to the tree, if there are no items
+     * whose name equals the name of the item to insert
+     *
+     * @param target The Item to insert
+     * @return True if the Item was successfully inserted, false otherwise.
+     */
+    bool insert(const Item& target);
+
+    /**
+     * @brief Erases the item whose name matches the target name
+     *
+     * @param name The name of the item to delete
+     * @param erased_weight Set to the weight of the erased Item, if any
+     * @return True if an Item was erased, false if none matched
+     */
+    bool erase(const std::string& name, float& erased_weight);
+
+    /**
+     * @brief Checks if the tree contains an item with a given name
+     * @param name The name to check for
+     * @return True if a matching Item exists, false otherwise.
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Removes every Item from the tree
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of Items in the tree
+     */
+    size_t size() const;
+
+    /**
+     * @brief Invokes a callback on every Item within a specified range according to
+     * the Comparator (inclusive on both ends), in sorted order
+     *
+     * Descends to the first leaf that can hold a match once, then walks along the leaves.
+     *
+     * @param start An Item whose compared property is the lower bound of the range
+     * @param end An Item whose compared property is the upper bound of the range
+     * @param visit A callable invoked with a const Item& for every matching Item
+     */
+    template <class Visitor>
+    void forEachInRange(const Item& start, const Item& end, Visitor visit) const;
+
+    /**
+     * @brief Returns an iterator to the smallest Item by Comparator
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Returns the iterator one past the largest Item by Comparator
+     */
+    const_iterator end() const;
+
+private:
+    // The most Items a leaf, & children an internal Node, may hold
+    static constexpr size_t LEAF_CAPACITY = 64;
+    static constexpr size_t INTERNAL_CAPACITY = 64;
+
+    // The fewest a non-root Node may hold before it is rebalanced
+    static constexpr size_t LEAF_MINIMUM = LEAF_CAPACITY / 2;
+    static constexpr size_t INTERNAL_MINIMUM = INTERNAL_CAPACITY / 2;
+
+    BTreeNode* root_; // The root of the tree, or nullptr if empty
+    size_t size_;
+
+    // Maps every Item name to the Item's weight & type, from which its key is rebuilt for erasure
+    std::unordered_map<ItemName, std::pair<float, ItemType>> name_index_;
+
+    /**
+     * @brief The strict ordering of the tree: Items are ordered by Comparator,
+     * and Items the Comparator considers equivalent are ordered by name.
+     *
+     * @param a First item to compare
+     * @param b Second item to compare
+     * @return true if a is ordered before b
+     */
+    static bool precedes(const Item& a, const Item& b);
+
+    /**
+     * @brief Creates an empty Node, reserving room for a full Node's contents
+     *
+     * @param leaf Whether the Node is a leaf
+     * @return A pointer to the new Node
+     */
+    static BTreeNode* createNode(bool leaf);
+
+    /**
+     * @brief Determines which child of an internal Node a key belongs to
+     *
+     * @param node The internal Node to search
+     * @param target The key to locate
+     * @return The index of the child whose subtree would hold target
+     */
+    static size_t childIndex(const BTreeNode* node, const Item& target);
+
+    /**
+     * @brief Internal routine to insert into a subtree
+     *
+     * @param node The root of the subtree to be inserted into
+     * @param target The Item to insert
+     * @param separator Set to the smallest key of the new right sibling, if node splits
+     * @param right Set to the new right sibling, if node splits
+     * @return True if node overflowed & was split in two, false otherwise
+     */
+    bool insert(BTreeNode* node, const Item& target, Item& separator, BTreeNode*& right);
+
+    /**
+     * @brief Internal routine to erase from a subtree
+     *
+     * @param node The root of the subtree to be erased from
+     * @param target The key of the Item to erase, which must exist within the subtree
+     * @post Every Node below node along the path holds at least the minimum number of entries
+     */
+    void erase(BTreeNode* node, const Item& target);
+
+    /**
+     * @brief Restores the minimum occupancy of an underfull child,
+     * by borrowing from a sibling or merging with one
+     *
+     * @param parent The internal Node whose child is underfull
+     * @param i The index of the underfull child
+     */
+    void rebalance(BTreeNode* parent, const size_t& i);
+
+    /**
+     * @brief Destroys the given Node and its children
+     *
+     * @param t The node to be deleted
+     */
+    void deleteTree(BTreeNode*& t);
+
+    /**
+     * @brief Deep copies the given subtree, linking each copied leaf after last_leaf
+     *
+     * @param t The root of the subtree to be copied
+     * @param last_leaf The most recently copied leaf, updated as leaves are copied
+     * @return The root of the copy
+     */
+    BTreeNode* clone(const BTreeNode* t, BTreeNode*& last_leaf);
+};
+
+#include "ItemBTree.cpp"
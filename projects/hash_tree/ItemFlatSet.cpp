@@ -0,0 +1,290 @@
+#include "ItemFlatSet.hpp"
+#include "InventoryCounters.hpp"
+#include <functional>
+#include <utility>
+
+// =========== ITERATION  ===========
+
+ItemFlatSet::const_iterator::const_iterator(const ItemFlatSet* set, size_t slot)
+    : set_ { set }
+    , slot_ { slot }
+{
+    skipEmpty();
+}
+
+void ItemFlatSet::const_iterator::skipEmpty()
+{
+    while (slot_ < set_->control_.size() && set_->control_[slot_].distance_ == EMPTY) {
+        slot_++;
+    }
+}
+
+ItemFlatSet::const_iterator::reference ItemFlatSet::const_iterator::operator*() const
+{
+    return set_->slots_[slot_];
+}
+
+ItemFlatSet::const_iterator::pointer ItemFlatSet::const_iterator::operator->() const
+{
+    return &set_->slots_[slot_];
+}
+
+ItemFlatSet::const_iterator& ItemFlatSet::const_iterator::operator++()
+{
+    slot_++;
+    skipEmpty();
+    return *this;
+}
+
+ItemFlatSet::const_iterator ItemFlatSet::const_iterator::operator++(int)
+{
+    const_iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+bool ItemFlatSet::const_iterator::operator==(const const_iterator& rhs) const
+{
+    return set_ == rhs.set_ && slot_ == rhs.slot_;
+}
+
+bool ItemFlatSet::const_iterator::operator!=(const const_iterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+ItemFlatSet::const_iterator ItemFlatSet::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+ItemFlatSet::const_iterator ItemFlatSet::end() const
+{
+    return const_iterator(this, control_.size());
+}
+
+// =========== SET OPERATIONS  ===========
+
+/**
+ * @brief Default Constructor: Construct a new, empty ItemFlatSet with no slots
+ */
+ItemFlatSet::ItemFlatSet()
+    : size_ { 0 }
+    , mask_ { 0 }
+{
+}
+
+/**
+ * @brief Hashes a name exactly as std::hash<Item> hashes an Item with that name,
+ * reusing the hash computed at interning when ITEM_INTERNED_NAMES is defined
+ */
+std::uint32_t ItemFlatSet::hashName(const ItemName& name)
+{
+    return static_cast<std::uint32_t>(std::hash<ItemName> {}(name));
+}
+
+/**
+ * @brief Finds the slot holding the Item with a given name
+ *
+ * @param name The name to search for
+ * @param hash The result of hashName(name)
+ * @return The index of the matching slot, or the capacity if none matches
+ */
+size_t ItemFlatSet::findSlot(const ItemName& name, const std::uint32_t& hash) const
+{
+    if (size_ == 0) {
+        return control_.size();
+    }
+
+    INVENTORY_COUNT(lookups_, 1);
+    size_t slot = hash & mask_;
+    for (std::uint32_t distance = 1;; distance++) {
+        INVENTORY_COUNT(probes_, 1);
+        const Control& control = control_[slot];
+        // Robin Hood invariant: had the Item been stored, it would have displaced this poorer entry
+        if (control.distance_ < distance) {
+            return control_.size();
+        }
+        if (control.hash_ == hash && slots_[slot].name_ == name) {
+            return slot;
+        }
+        slot = (slot + 1) & mask_;
+    }
+}
+
+/**
+ * @brief Finds the Item with a given name
+ *
+ * @param name The name to search for
+ * @return A const pointer to the matching Item, or nullptr if none exists
+ */
+const Item* ItemFlatSet::find(const std::string& name) const
+{
+    const ItemName* key = findItemName(name);
+    if (key == nullptr) {
+        return nullptr;
+    }
+    size_t slot = findSlot(*key, hashName(*key));
+    if (slot == control_.size()) {
+        return nullptr;
+    }
+    return &slots_[slot];
+}
+
+/**
+ * @brief Checks if the set contains an Item with a given name
+ *
+ * @param name The name to search for
+ * @return True if a matching Item exists, false otherwise
+ */
+bool ItemFlatSet::contains(const std::string& name) const
+{
+    return find(name) != nullptr;
+}
+
+/**
+ * @brief Inserts an Item, if there are no items whose name equals its name
+ *
+ * @param item The Item to insert
+ * @return True if the Item was inserted, false if its name was already present
+ */
+bool ItemFlatSet::insert(const Item& item)
+{
+    std::uint32_t hash = hashName(item.name_);
+    if (findSlot(item.name_, hash) != control_.size()) {
+        return false;
+    }
+    reserve(size_ + 1);
+    place(Item(item), hash);
+    size_++;
+    return true;
+}
+
+/**
+ * @brief Places an Item known to be absent, displacing richer entries along the way
+ *
+ * @param item The Item to place, which may be moved from
+ * @param hash The cached hash of the Item
+ */
+void ItemFlatSet::place(Item&& item, std::uint32_t hash)
+{
+    size_t slot = hash & mask_;
+    std::uint32_t distance = 1;
+    while (true) {
+        Control& control = control_[slot];
+        if (control.distance_ == EMPTY) {
+            control = { hash, distance };
+            slots_[slot] = std::move(item);
+            return;
+        }
+        // Take the slot from an entry closer to its home, & carry on placing that entry instead
+        if (control.distance_ < distance) {
+            std::swap(control.hash_, hash);
+            std::swap(control.distance_, distance);
+            std::swap(slots_[slot], item);
+        }
+        slot = (slot + 1) & mask_;
+        distance++;
+    }
+}
+
+/**
+ * @brief Erases the Item with a given name
+ *
+ * @param name The name of the Item to erase
+ * @param erased_weight Set to the weight of the erased Item, if any
+ * @return True if an Item was erased, false if none matched
+ */
+bool ItemFlatSet::erase(const std::string& name, float& erased_weight)
+{
+    const ItemName* key = findItemName(name);
+    if (key == nullptr) {
+        return false;
+    }
+    size_t slot = findSlot(*key, hashName(*key));
+    if (slot == control_.size()) {
+        return false;
+    }
+    erased_weight = slots_[slot].weight_;
+
+    // Backward-shift deletion: pull each following displaced entry one slot closer to home
+    size_t next = (slot + 1) & mask_;
+    while (control_[next].distance_ > 1) {
+        control_[slot] = { control_[next].hash_, control_[next].distance_ - 1 };
+        slots_[slot] = std::move(slots_[next]);
+        slot = next;
+        next = (next + 1) & mask_;
+    }
+    control_[slot].distance_ = EMPTY;
+    slots_[slot] = Item();
+    size_--;
+    return true;
+}
+
+/**
+ * @brief Grows the table so that it can hold count Items without rehashing
+ *
+ * @param count The number of Items to make room for
+ */
+void ItemFlatSet::reserve(const size_t& count)
+{
+    // Keep the load factor at or below 7/8
+    if (count * 8 <= control_.size() * 7) {
+        return;
+    }
+    size_t capacity = control_.empty() ? MIN_CAPACITY : control_.size();
+    while (count * 8 > capacity * 7) {
+        capacity *= 2;
+    }
+    rehash(capacity);
+}
+
+/**
+ * @brief Rebuilds the table with a given number of slots, reusing the cached hashes
+ *
+ * @param capacity The new number of slots, a power of 2 large enough for every Item
+ */
+void ItemFlatSet::rehash(const size_t& capacity)
+{
+    std::vector<Control> old_control(capacity, Control { 0, EMPTY });
+    std::vector<Item> old_slots(capacity);
+    old_control.swap(control_);
+    old_slots.swap(slots_);
+    mask_ = capacity - 1;
+
+    for (size_t i = 0; i < old_control.size(); i++) {
+        if (old_control[i].distance_ != EMPTY) {
+            place(std::move(old_slots[i]), old_control[i].hash_);
+        }
+    }
+}
+
+/**
+ * @brief Removes every Item, keeping the allocated slots
+ */
+void ItemFlatSet::clear()
+{
+    for (size_t i = 0; i < control_.size(); i++) {
+        if (control_[i].distance_ != EMPTY) {
+            control_[i].distance_ = EMPTY;
+            slots_[i] = Item();
+        }
+    }
+    size_ = 0;
+}
+
+/**
+ * @brief Returns the number of Items in the set
+ */
+size_t ItemFlatSet::size() const
+{
+    return size_;
+}
+
+/**
+ * @brief Returns the number of slots in the table
+ */
+size_t ItemFlatSet::capacity() const
+{
+    return control_.size();
+}
@@ -0,0 +1,166 @@
+/**
+ * @file ItemFlatSet.hpp
+ * @brief Defines an open-addressing hash set of Items, keyed by name
+ */
+
+#pragma once
+#include "Item.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * @class ItemFlatSet
+ * @brief A Robin Hood hash set storing Items in one contiguous array, keyed by their names
+ *
+ * Each slot has a small control entry holding the slot's cached hash & its distance
+ * from its home slot. Probes only read the control entries (which are packed together)
+ * & compare names when the cached hashes match, so a lookup touches a couple of cache
+ * lines instead of chasing a pointer per element like std::unordered_set.
+ *
+ * Erasure uses backward-shift deletion, so there are no tombstones & probe lengths
+ * stay short under churn.
+ *
+ * @note Unlike std::unordered_set, inserting or erasing may move other Items,
+ * invalidating all pointers, references & iterators into the set.
+ */
+class ItemFlatSet {
+public:
+    /**
+     * @class const_iterator
+     * @brief A read-only iterator over the occupied slots, in table order
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Item;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Item*;
+        using reference = const Item&;
+
+        const_iterator(const ItemFlatSet* set, size_t slot);
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& rhs) const;
+        bool operator!=(const const_iterator& rhs) const;
+
+    private:
+        const ItemFlatSet* set_;
+        size_t slot_;
+
+        // Advances slot_ to the next occupied slot, or to the capacity if there are none
+        void skipEmpty();
+    };
+
+    /**
+     * @brief Default Constructor: Construct a new, empty ItemFlatSet with no slots
+     */
+    ItemFlatSet();
+
+    /**
+     * @brief Inserts an Item, if there are no items whose name equals its name
+     *
+     * @param item The Item to insert
+     * @return True if the Item was inserted, false if its name was already present
+     */
+    bool insert(const Item& item);
+
+    /**
+     * @brief Finds the Item with a given name
+     *
+     * @param name The name to search for
+     * @return A const pointer to the matching Item, or nullptr if none exists
+     */
+    const Item* find(const std::string& name) const;
+
+    /**
+     * @brief Checks if the set contains an Item with a given name
+     *
+     * @param name The name to search for
+     * @return True if a matching Item exists, false otherwise
+     */
+    bool contains(const std::string& name) const;
+
+    /**
+     * @brief Erases the Item with a given name
+     *
+     * @param name The name of the Item to erase
+     * @param erased_weight Set to the weight of the erased Item, if any
+     * @return True if an Item was erased, false if none matched
+     */
+    bool erase(const std::string& name, float& erased_weight);
+
+    /**
+     * @brief Grows the table so that it can hold count Items without rehashing
+     *
+     * @param count The number of Items to make room for
+     */
+    void reserve(const size_t& count);
+
+    /**
+     * @brief Removes every Item, keeping the allocated slots
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of Items in the set
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of slots in the table
+     */
+    size_t capacity() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    // Distances are stored plus one, so that a distance of 0 marks an empty slot
+    static constexpr std::uint32_t EMPTY = 0;
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    struct Control {
+        std::uint32_t hash_; // The low bits of the stored Item's hash
+        std::uint32_t distance_; // 1 + the number of slots from the Item's home slot, or EMPTY
+    };
+
+    std::vector<Control> control_;
+    std::vector<Item> slots_;
+    size_t size_;
+    size_t mask_; // capacity - 1, where the capacity is a power of 2
+
+    /**
+     * @brief Hashes a name exactly as std::hash<Item> hashes an Item with that name,
+     * reusing the hash computed at interning when ITEM_INTERNED_NAMES is defined
+     */
+    static std::uint32_t hashName(const ItemName& name);
+
+    /**
+     * @brief Finds the slot holding the Item with a given name
+     *
+     * @param name The name to search for
+     * @param hash The result of hashName(name)
+     * @return The index of the matching slot, or the capacity if none matches
+     */
+    size_t findSlot(const ItemName& name, const std::uint32_t& hash) const;
+
+    /**
+     * @brief Places an Item known to be absent, displacing richer entries along the way
+     *
+     * @param item The Item to place, which may be moved from
+     * @param hash The cached hash of the Item
+     */
+    void place(Item&& item, std::uint32_t hash);
+
+    /**
+     * @brief Rebuilds the table with a given number of slots, reusing the cached hashes
+     *
+     * @param capacity The new number of slots, a power of 2 large enough for every Item
+     */
+    void rehash(const size_t& capacity);
+};
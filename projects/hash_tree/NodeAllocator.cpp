@@ -0,0 +1,120 @@
+#include "NodeAllocator.hpp"
+
+/**
+ * @brief Default Constructor: Construct an empty pool with no slabs
+ */
+template <class T>
+PoolAllocator<T>::PoolAllocator()
+    : free_list_ { nullptr }
+    , slab_used_ { 0 }
+    , slab_capacity_ { 0 }
+    , capacity_ { 0 }
+{
+}
+
+/**
+ * @brief Constructs a T in a free slot, allocating a new slab if none are free
+ *
+ * @param args The arguments forwarded to T's constructor
+ * @return A pointer to the newly constructed T
+ */
+template <class T>
+template <class... Args>
+T* PoolAllocator<T>::create(Args&&... args)
+{
+    Slot* slot = nullptr;
+    if (free_list_) {
+        slot = free_list_;
+        free_list_ = free_list_->next_;
+    } else {
+        if (slab_used_ == slab_capacity_) {
+            slab_capacity_ = slab_capacity_ ? std::min(slab_capacity_ * 2, MAX_SLAB) : MIN_SLAB;
+            slabs_.emplace_back(new Slot[slab_capacity_]);
+            slab_used_ = 0;
+            capacity_ += slab_capacity_;
+        }
+        slot = &slabs_.back()[slab_used_++];
+    }
+
+    try {
+        return ::new (static_cast<void*>(slot->storage_)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        slot->next_ = free_list_;
+        free_list_ = slot;
+        throw;
+    }
+}
+
+/**
+ * @brief Destroys an object & returns its slot to the free list
+ *
+ * @param p A pointer previously returned by create(), or nullptr
+ */
+template <class T>
+void PoolAllocator<T>::destroy(T* p)
+{
+    if (p == nullptr) {
+        return;
+    }
+    p->~T();
+    Slot* slot = reinterpret_cast<Slot*>(p);
+    slot->next_ = free_list_;
+    free_list_ = slot;
+}
+
+/**
+ * @brief Frees every slab in one step
+ *
+ * @pre Every object created by this pool has been destroyed
+ * @post The pool is empty, as if default constructed
+ */
+template <class T>
+void PoolAllocator<T>::release()
+{
+    slabs_.clear();
+    free_list_ = nullptr;
+    slab_used_ = 0;
+    slab_capacity_ = 0;
+    capacity_ = 0;
+}
+
+/**
+ * @brief Returns the number of slots the pool currently holds, used or not
+ */
+template <class T>
+size_t PoolAllocator<T>::capacity() const
+{
+    return capacity_;
+}
+
+/**
+ * @brief Constructs a T with new
+ *
+ * @param args The arguments forwarded to T's constructor
+ * @return A pointer to the newly constructed T
+ */
+template <class T>
+template <class... Args>
+T* HeapAllocator<T>::create(Args&&... args)
+{
+    return new T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Destroys an object with delete
+ *
+ * @param p A pointer previously returned by create(), or nullptr
+ */
+template <class T>
+void HeapAllocator<T>::destroy(T* p)
+{
+    delete p;
+}
+
+/**
+ * @brief Does nothing, since every object was freed by destroy()
+ */
+template <class T>
+void HeapAllocator<T>::release()
+{
+}
@@ -0,0 +1,115 @@
+/**
+ * @file NodeAllocator.hpp
+ * @brief Defines the allocation policies used by ItemAVL to create & destroy its Nodes
+ *
+ * An allocation policy provides:
+ *  - T* create(args...) : Constructs a T from args & returns a pointer to it
+ *  - void destroy(T* p) : Destroys an object previously returned by create()
+ *  - void release()     : Returns all memory held by the policy, once every object has been destroyed
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @class PoolAllocator
+ * @brief Allocates objects from contiguous slabs, recycling destroyed slots through a free list
+ *
+ * Slabs double in size (up to MAX_SLAB slots) as the pool grows, so neighbouring
+ * allocations stay close together in memory & the global allocator is called
+ * O(log MAX_SLAB + n / MAX_SLAB) times for n live objects instead of n times.
+ *
+ * @note A pool is tied to the container that owns it, so it cannot be copied.
+ */
+template <class T>
+class PoolAllocator {
+public:
+    /**
+     * @brief Default Constructor: Construct an empty pool with no slabs
+     */
+    PoolAllocator();
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    /**
+     * @brief Constructs a T in a free slot, allocating a new slab if none are free
+     *
+     * @param args The arguments forwarded to T's constructor
+     * @return A pointer to the newly constructed T
+     */
+    template <class... Args>
+    T* create(Args&&... args);
+
+    /**
+     * @brief Destroys an object & returns its slot to the free list
+     *
+     * @param p A pointer previously returned by create(), or nullptr
+     */
+    void destroy(T* p);
+
+    /**
+     * @brief Frees every slab in one step
+     *
+     * @pre Every object created by this pool has been destroyed
+     * @post The pool is empty, as if default constructed
+     */
+    void release();
+
+    /**
+     * @brief Returns the number of slots the pool currently holds, used or not
+     */
+    size_t capacity() const;
+
+private:
+    static constexpr size_t MIN_SLAB = 32;
+    static constexpr size_t MAX_SLAB = 4096;
+
+    // A slot either holds a live T, or links to the next free slot
+    union Slot {
+        Slot* next_;
+        alignas(T) unsigned char storage_[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+    Slot* free_list_; // The most recently destroyed slot, or nullptr if none are free
+    size_t slab_used_; // The number of slots handed out from the newest slab
+    size_t slab_capacity_; // The number of slots in the newest slab
+    size_t capacity_; // The number of slots across all slabs
+};
+
+/**
+ * @class HeapAllocator
+ * @brief Allocates every object individually with new & frees it with delete
+ */
+template <class T>
+class HeapAllocator {
+public:
+    /**
+     * @brief Constructs a T with new
+     *
+     * @param args The arguments forwarded to T's constructor
+     * @return A pointer to the newly constructed T
+     */
+    template <class... Args>
+    T* create(Args&&... args);
+
+    /**
+     * @brief Destroys an object with delete
+     *
+     * @param p A pointer previously returned by create(), or nullptr
+     */
+    void destroy(T* p);
+
+    /**
+     * @brief Does nothing, since every object was freed by destroy()
+     */
+    void release();
+};
+
+#include "NodeAllocator.cpp"
@@ -0,0 +1,118 @@
+#include "OrderedItemIndex.hpp"
+
+/**
+ * @brief Default Constructor: Construct a new, stale OrderedItemIndex
+ */
+template <class Comparator>
+OrderedItemIndex<Comparator>::OrderedItemIndex()
+    : fresh_ { false }
+    , stale_queries_ { 0 }
+{
+}
+
+/**
+ * @brief Copy Constructor: Constructs a stale index, ignoring rhs's pointers
+ */
+template <class Comparator>
+OrderedItemIndex<Comparator>::OrderedItemIndex(const OrderedItemIndex&)
+    : fresh_ { false }
+    , stale_queries_ { 0 }
+{
+}
+
+/**
+ * @brief Copy Assignment: Clears the index & marks it stale, ignoring rhs's pointers
+ * @return A reference to the updated OrderedItemIndex
+ */
+template <class Comparator>
+OrderedItemIndex<Comparator>& OrderedItemIndex<Comparator>::operator=(const OrderedItemIndex&)
+{
+    sorted_.clear();
+    markStale();
+    return *this;
+}
+
+/**
+ * @brief Marks the index stale; queries scan the container until it is rebuilt
+ */
+template <class Comparator>
+void OrderedItemIndex<Comparator>::markStale()
+{
+    fresh_.store(false, std::memory_order_relaxed);
+    stale_queries_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Refills sorted_ from items & sorts it
+ */
+template <class Comparator>
+template <class Container>
+void OrderedItemIndex<Comparator>::rebuild(const Container& items) const
+{
+    sorted_.clear();
+    sorted_.reserve(items.size());
+    for (const Item& value : items) {
+        sorted_.push_back(&value);
+    }
+    std::sort(sorted_.begin(), sorted_.end(),
+        [](const Item* a, const Item* b) { return Comparator::lessThan(*a, *b); });
+}
+
+/**
+ * @brief Calls visitor on each Item of the container which is at least start & at most end, by Comparator
+ *
+ * @param items The container being indexed, iterable as const Item&
+ * @param start An Item whose compared property is the lower bound of the range
+ * @param end An Item whose compared property is the upper bound of the range
+ * @param visitor A callable taking a const Item&
+ * @return true if the Items were visited in ascending order, false if they were
+ *      visited in the container's order, by a scan
+ * @post The index is rebuilt from items if it was stale for log2(n) queries in a row
+ */
+template <class Comparator>
+template <class Container, class Visitor>
+bool OrderedItemIndex<Comparator>::visit(const Container& items, const Item& start, const Item& end,
+    Visitor visitor) const
+{
+    if (!fresh_.load(std::memory_order_acquire)) {
+        // A scan costs n comparisons & a rebuild about n log2(n), so rebuild once log2(n)
+        // queries in a row have scanned: then the scans have paid for the sort.
+        size_t log_n = 0;
+        for (size_t n = items.size(); n > 1; n >>= 1) {
+            log_n++;
+        }
+
+        bool rebuilt = false;
+        if (stale_queries_.fetch_add(1, std::memory_order_relaxed) >= log_n) {
+            // Only one query rebuilds; any other arriving meanwhile scans instead of waiting
+            std::unique_lock<std::mutex> lock(rebuild_mutex_, std::try_to_lock);
+            if (lock.owns_lock()) {
+                if (!fresh_.load(std::memory_order_relaxed)) {
+                    rebuild(items);
+                    fresh_.store(true, std::memory_order_release);
+                }
+                rebuilt = true;
+            }
+        }
+
+        if (!rebuilt) {
+            for (const Item& value : items) {
+                if (Comparator::leq(start, value) && Comparator::leq(value, end)) {
+                    visitor(value);
+                }
+            }
+            return false;
+        }
+    }
+
+    // Nothing writes sorted_ while it is fresh, so any number of queries can read it
+    const_iterator first = sorted_.data();
+    const_iterator last = first + sorted_.size();
+
+    first = std::partition_point(first, last,
+        [&start](const Item* value) { return Comparator::lessThan(*value, start); });
+    for (; first != last && Comparator::leq(**first, end); ++first) {
+        visitor(**first);
+    }
+    return true;
+}
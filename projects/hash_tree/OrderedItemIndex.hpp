@@ -0,0 +1,93 @@
+/**
+ * @file OrderedItemIndex.hpp
+ * @brief Defines a lazily sorted side index, letting unordered Item containers answer range queries by binary search
+ */
+
+#pragma once
+#include "Item.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class OrderedItemIndex
+ * @brief Pointers to the Items of a container, sorted by Comparator
+ *
+ * The owning container marks the index stale whenever it changes. A stale index isn't
+ * rebuilt straight away: queries scan the container (O(n)) until a run of them has cost
+ * about as much as a sort, i.e. log2(n) queries in a row, & only then is the index rebuilt
+ * (O(n log n)), so queries between changes cost O(log n + k). Interleaved writes & queries
+ * therefore cost no more than the plain scan they replace, at most twice over.
+ *
+ * visit() may be called by many threads at once, as long as no thread modifies the
+ * container meanwhile (the usual rule for const methods): one of them rebuilds the index,
+ * & the others keep scanning instead of waiting for it.
+ *
+ * The pointers are only read while the index is fresh, so it suits any container
+ * whose Items stay in place until it is next modified.
+ * A copied index starts out stale, since its pointers refer to the original container.
+ *
+ * @tparam Comparator The comparison class that orders the index
+ */
+template <class Comparator>
+class OrderedItemIndex {
+public:
+    using const_iterator = const Item* const*;
+
+    /**
+     * @brief Default Constructor: Construct a new, stale OrderedItemIndex
+     */
+    OrderedItemIndex();
+
+    /**
+     * @brief Copy Constructor: Constructs a stale index, ignoring rhs's pointers
+     */
+    OrderedItemIndex(const OrderedItemIndex& rhs);
+
+    /**
+     * @brief Copy Assignment: Clears the index & marks it stale, ignoring rhs's pointers
+     * @return A reference to the updated OrderedItemIndex
+     */
+    OrderedItemIndex& operator=(const OrderedItemIndex& rhs);
+
+    /**
+     * @brief Marks the index stale; queries scan the container until it is rebuilt
+     */
+    void markStale();
+
+    /**
+     * @brief Calls visitor on each Item of the container which is at least start & at most end, by Comparator
+     *
+     * @param items The container being indexed, iterable as const Item&
+     * @param start An Item whose compared property is the lower bound of the range
+     * @param end An Item whose compared property is the upper bound of the range
+     * @param visitor A callable taking a const Item&
+     * @return true if the Items were visited in ascending order, false if they were
+     *      visited in the container's order, by a scan
+     * @post The index is rebuilt from items if it was stale for log2(n) queries in a row
+     */
+    template <class Container, class Visitor>
+    bool visit(const Container& items, const Item& start, const Item& end, Visitor visitor) const;
+
+private:
+    mutable std::vector<const Item*> sorted_;
+
+    // Whether sorted_ matches the container; set (with release) only once sorted_ is complete
+    mutable std::atomic<bool> fresh_;
+
+    // The number of queries that scanned since the index was marked stale
+    mutable std::atomic<size_t> stale_queries_;
+
+    // Held by the query rebuilding sorted_; other queries only try to take it
+    mutable std::mutex rebuild_mutex_;
+
+    /**
+     * @brief Refills sorted_ from items & sorts it
+     */
+    template <class Container>
+    void rebuild(const Container& items) const;
+};
+
+#include "OrderedItemIndex.cpp"
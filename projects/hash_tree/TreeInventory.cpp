@@ -82,6 +82,20 @@ ItemAVL<Comparator> Inventory<Comparator, Tree>::getItems() const
     return items_;
 }
 
+/**
+ * @brief Exposes a read-only view of the container holding inventory items.
+ *
+ * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+ * The view iterates in-order by Comparator; its iterators stay valid until the inventory is modified.
+ *
+ * @return A const reference to the container of items in the inventory
+ */
+template <class Comparator>
+const ItemAVL<Comparator>& Inventory<Comparator, Tree>::items() const
+{
+    return items_;
+}
+
 /**
  * @brief Attempts to add a new item to the inventory.
  *
@@ -99,6 +113,43 @@ bool Inventory<Comparator, Tree>::pickup(const Item& target)
     return false;
 }
 
+/**
+ * @brief Attempts to add every item of a range to the inventory.
+ *
+ * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+ * @return The number of Items added; Items whose name is already in the
+ *         inventory, or earlier in the batch, are skipped like in pickup
+ * @post Updates the weight_ member to reflect the new Items
+ * @note When the batch is at least as large as the inventory, the tree is rebuilt from
+ * scratch by ItemAVL::assign, sorting once instead of rebalancing after every Item.
+ */
+template <class Comparator>
+template <class Range>
+size_t Inventory<Comparator, Tree>::pickupBatch(const Range& batch)
+{
+    size_t count = std::distance(std::begin(batch), std::end(batch));
+    size_t before = items_.size();
+    if (count < before) {
+        size_t added = 0;
+        for (const Item& target : batch) {
+            added += pickup(target);
+        }
+        return added;
+    }
+
+    // The current Items go first, so they win over any batch Item with the same name
+    std::vector<Item> combined(items_.begin(), items_.end());
+    combined.insert(combined.end(), std::begin(batch), std::end(batch));
+
+    items_.assign(combined.begin(), combined.end());
+
+    weight_ = 0;
+    for (const Item& item : items_) {
+        weight_ += item.weight_;
+    }
+    return items_.size() - before;
+}
+
 /**
  * @brief Attempts to remove an item from the inventory by name.
  *
@@ -109,8 +160,8 @@ bool Inventory<Comparator, Tree>::pickup(const Item& target)
 template <class Comparator>
 bool Inventory<Comparator, Tree>::discard(const std::string& itemName)
 {
-    float erased_weight = items_.erase(itemName);
-    if (erased_weight) {
+    float erased_weight = 0;
+    if (items_.erase(itemName, erased_weight)) {
         weight_ -= erased_weight;
         return true;
     }
@@ -150,31 +201,119 @@ template <class Comparator>
 std::unordered_set<Item> Inventory<Comparator, Tree>::query(const Item& start, const Item& end) const
 {
     std::unordered_set<Item> result;
+    forEachInRange(start, end, [&result](const Item& i) { result.insert(i); });
+    return result;
+}
 
+/**
+ * @brief Queries the inventory for items within a specified range,
+ * appending them to a caller-provided vector in sorted order.
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param result The vector to which matching Items are appended, in ascending order by Comparator
+ *
+ * @note Appends nothing if the end item is less than the start item
+ */
+template <class Comparator>
+void Inventory<Comparator, Tree>::query(const Item& start, const Item& end, std::vector<Item>& result) const
+{
+    forEachInRange(start, end, [&result](const Item& i) { result.push_back(i); });
+}
+
+/**
+ * @brief Invokes a callback on every item within a specified range, in sorted order,
+ * without copying any Items.
+ *
+ * @param start An Item whose compared property is the lower bound of the query range
+ * @param end An Item whose compared property is the upper bound of the query range
+ * @param visit A callable invoked with a const Item& for every matching Item
+ *
+ * @note Visits nothing if the end item is less than the start item
+ */
+template <class Comparator>
+template <class Visitor>
+void Inventory<Comparator, Tree>::forEachInRange(const Item& start, const Item& end, Visitor visit) const
+{
     if (Comparator::leq(start, end)) {
-        queryHelper(start, end, items_.root(), result);
+        queryHelper(start, end, items_.root(), visit);
     }
-    return result;
 }
 
+/**
+ * @brief Counts the items ordered strictly before a given item by Comparator
+ *
+ * @param item An Item whose compared property is to be ranked
+ * @return The number of items that are less than item, in O(log n)
+ */
 template <class Comparator>
-void Inventory<Comparator, Tree>::queryHelper(const Item& start, const Item& end, const Node* root, std::unordered_set<Item>& result) const
+size_t Inventory<Comparator, Tree>::rank(const Item& item) const
 {
+    return items_.rank(item);
+}
 
+/**
+ * @brief Retrieves the k-th smallest item by Comparator
+ *
+ * @param k The 0-based position, where 0 is the smallest item
+ * @return A const reference to the item, found in O(log n)
+ * @throws std::out_of_range If k is not less than size()
+ */
+template <class Comparator>
+const Item& Inventory<Comparator, Tree>::select(const size_t& k) const
+{
+    return items_.select(k);
+}
+
+/**
+ * @brief Counts the items within a specified range according to
+ * the Comparator (inclusive on both ends), without visiting them
+ *
+ * @param start An Item whose compared property is the lower bound of the range
+ * @param end An Item whose compared property is the upper bound of the range
+ * @return The number of items in [start, end], in O(log n), or 0 if end is less than start
+ */
+template <class Comparator>
+size_t Inventory<Comparator, Tree>::countRange(const Item& start, const Item& end) const
+{
+    return items_.countRange(start, end);
+}
+
+/**
+ * @brief Visits, in sorted order, the Items of a subtree that fall within [start, end]
+ *
+ * Only descends into a child if its subtree can overlap the range,
+ * so a query visits O(log n + k) Nodes for k matching Items.
+ *
+ * @param start The lower bound of the query range
+ * @param end The upper bound of the query range
+ * @param root The root of the subtree to be searched
+ * @param visit A callable invoked with a const Item& for every matching Item
+ */
+template <class Comparator>
+template <class Visitor>
+void Inventory<Comparator, Tree>::queryHelper(const Item& start, const Item& end, const Node* root, Visitor& visit) const
+{
     if (!root) {
         return;
     }
+    INVENTORY_COUNT(nodes_visited_, 1);
+
+    // Everything left of root is at most root, so it can only match if root is at least start
+    bool afterStart = Comparator::leq(start, root->value_);
+    // Everything right of root is at least root, so it can only match if root is at most end
+    bool beforeEnd = Comparator::leq(root->value_, end);
 
-    if (root->left_) {
-        queryHelper(start, end, root->left_, result);
+    if (afterStart) {
+        queryHelper(start, end, root->left_, visit);
     }
 
-    if (Comparator::leq(start, root->value_) && Comparator::leq(root->value_, end)) {
-        result.insert(root->value_);
+    if (afterStart && beforeEnd) {
+        visit(root->value_);
     }
 
-    if (root->right_) {
-        queryHelper(start, end, root->right_, result);
+    if (beforeEnd) {
+        queryHelper(start, end, root->right_, visit);
     }
 }
 
@@ -12,7 +12,19 @@ class Inventory<Comparator, Tree> {
 private:
     ItemAVL<Comparator> items_;
 
-    void queryHelper(const Item& start, const Item& end, const Node* root, std::unordered_set<Item>& result) const;
+    /**
+     * @brief Visits, in sorted order, the Items of a subtree that fall within [start, end]
+     *
+     * Only descends into a child if its subtree can overlap the range,
+     * so a query visits O(log n + k) Nodes for k matching Items.
+     *
+     * @param start The lower bound of the query range
+     * @param end The upper bound of the query range
+     * @param root The root of the subtree to be searched
+     * @param visit A callable invoked with a const Item& for every matching Item
+     */
+    template <class Visitor>
+    void queryHelper(const Item& start, const Item& end, const Node* root, Visitor& visit) const;
 
 protected:
     // A pointer to a dynamically allocated Item outside of the Player's bag
@@ -70,6 +82,16 @@ public:
      */
     ItemAVL<Comparator> getItems() const;
 
+    /**
+     * @brief Exposes a read-only view of the container holding inventory items.
+     *
+     * Unlike getItems(), nothing is copied, so reading through the view allocates nothing.
+     * The view iterates in-order by Comparator; its iterators stay valid until the inventory is modified.
+     *
+     * @return A const reference to the container of items in the inventory
+     */
+    const ItemAVL<Comparator>& items() const;
+
     /**
      * @brief Attempts to add a new item to the inventory.
      *
@@ -80,6 +102,19 @@ public:
      */
     bool pickup(const Item& target);
 
+    /**
+     * @brief Attempts to add every item of a range to the inventory.
+     *
+     * @param batch A range of Items (anything with begin() & end(), e.g. a std::vector<Item>)
+     * @return The number of Items added; Items whose name is already in the
+     *         inventory, or earlier in the batch, are skipped like in pickup
+     * @post Updates the weight_ member to reflect the new Items
+     * @note When the batch is at least as large as the inventory, the tree is rebuilt from
+     * scratch by ItemAVL::assign, sorting once instead of rebalancing after every Item.
+     */
+    template <class Range>
+    size_t pickupBatch(const Range& batch);
+
     /**
      * @brief Attempts to remove an item from the inventory by name.
      *
@@ -117,6 +152,66 @@ public:
      */
     std::unordered_set<Item> query(const Item& start, const Item& end) const;
 
+    /**
+     * @brief Queries the inventory for items within a specified range,
+     * appending them to a caller-provided vector in sorted order.
+     *
+     * Unlike the std::unordered_set overload, this neither hashes nor allocates per
+     * Item found, & lets the caller reuse the same vector across queries.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param result The vector to which matching Items are appended, in ascending order by Comparator
+     *
+     * @note Appends nothing if the end item is less than the start item
+     */
+    void query(const Item& start, const Item& end, std::vector<Item>& result) const;
+
+    /**
+     * @brief Invokes a callback on every item within a specified range, in sorted order,
+     * without copying any Items.
+     *
+     * @param start An Item whose compared property is the lower bound of the query range
+     * @param end An Item whose compared property is the upper bound of the query range
+     * @param visit A callable invoked with a const Item& for every matching Item
+     *
+     * @note Visits nothing if the end item is less than the start item
+     * @example To total the weight of all armor, in an Inventory<CompareItemType, Tree> inv:
+     *  float total = 0;
+     *  inv.forEachInRange(Item("", 0, ARMOR), Item("", 0, ARMOR), [&total](const Item& i) { total += i.weight_; });
+     */
+    template <class Visitor>
+    void forEachInRange(const Item& start, const Item& end, Visitor visit) const;
+
+    /**
+     * @brief Counts the items ordered strictly before a given item by Comparator
+     *
+     * @param item An Item whose compared property is to be ranked
+     * @return The number of items that are less than item, in O(log n)
+     */
+    size_t rank(const Item& item) const;
+
+    /**
+     * @brief Retrieves the k-th smallest item by Comparator
+     *
+     * @param k The 0-based position, where 0 is the smallest item
+     * @return A const reference to the item, found in O(log n)
+     * @throws std::out_of_range If k is not less than size()
+     * @example To list a page of `count` items starting at `offset` without copying the inventory:
+     *  for (size_t k = offset; k < std::min(offset + count, inv.size()); k++) display(inv.select(k));
+     */
+    const Item& select(const size_t& k) const;
+
+    /**
+     * @brief Counts the items within a specified range according to
+     * the Comparator (inclusive on both ends), without visiting them
+     *
+     * @param start An Item whose compared property is the lower bound of the range
+     * @param end An Item whose compared property is the upper bound of the range
+     * @return The number of items in [start, end], in O(log n), or 0 if end is less than start
+     */
+    size_t countRange(const Item& start, const Item& end) const;
+
     /**
      * @brief Destructor for the Inventory class.
      * @post Deallocates any dynamically allocated resources.
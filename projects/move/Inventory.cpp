@@ -5,25 +5,46 @@
 */
 
 /**
- * Addendum 1:
- * In Inventory.hpp, line 38 uses the constructor, std::vector(10, std::vector<Item>(10, Item{}))
- * By the C++ standard, this is a valid constructor, and it works on Gradescope and on other C++17 compilers we've tested.
- * If it's generating an error for you anyway, you may edit the file to explicitly declare the value type as follows:
-std::vector<std::vector<Item>>(10, std::vector<Item>(10, Item{}))
- * 
- * Note 2: Code that attempts to dereference a null pointer will compile just fine, 
+ * Note: Code that attempts to dereference a null pointer will compile just fine, 
  * but may get runtime errors or simply give the wrong output. 
  * And it will certainly fail any well-written unit tests.
  */
 
 #include "Inventory.hpp"
+#include <algorithm>
 #include <stdexcept>
 #include <vector> 
 
 /**
-* @brief Constructor with optional parameters for initialization.
-* @param items A const reference to a 2D vector of items. 
-*  Defaults to a 10x10 grid of default-constructed items, if none provided.
+ * @brief Constructs an empty 10 x 10 grid of default-constructed items,
+ *  with nothing equipped.
+ */
+Inventory::Inventory() : Inventory(10, 10) {}
+
+/**
+ * @brief Constructs an empty grid of default-constructed items.
+ * @param rows The number of rows.
+ * @param cols The number of columns. Defaults to 10, if none provided.
+ * @param equipped A pointer to an Item object. 
+ *  Defaults to nullptr, if none provided.
+ * 
+ * @post `weight_` and `item_count_` are 0.
+ */
+Inventory::Inventory(const size_t& rows, const size_t& cols, Item* equipped) : inventory_grid_(makeGrid(rows * cols)), rows_(rows), cols_(cols) {
+    if (equipped != nullptr && equipped->type_ != NONE) {
+        equipped_ = equipped;
+    } else {
+        equipped_ = nullptr;
+    }
+
+    weight_ = 0;
+    item_count_ = 0;
+}
+
+/**
+* @brief Constructor from a 2D vector of items.
+* @param items A const reference to a 2D vector of items, one inner vector per row.
+*  Rows shorter than the longest are padded with default-constructed items.
 * @param equipped A pointer to an Item object. 
 *  Defaults to nullptr, if none provided.
 * 
@@ -33,27 +54,102 @@ std::vector<std::vector<Item>>(10, std::vector<Item>(10, Item{}))
 * 
 * NOTE: The `equipped` item is excluded from these calculations.
 */
-Inventory::Inventory(const std::vector<std::vector<Item>>& items, Item* equipped) : inventory_grid_(items) {
-    if (equipped != nullptr && equipped->type_ != NONE) {
-        equipped_ = equipped;
-    } else {
-        equipped_ = nullptr;
+Inventory::Inventory(const std::vector<std::vector<Item>>& items, Item* equipped) : Inventory(items.size(), widest(items), equipped) {
+    // copies every row into its slice of the grid, updating total weight_ and item_count
+    std::vector<Item>& cells = mutableGrid();
+    for (size_t row = 0; row < rows_; ++row) {
+        for (size_t col = 0; col < items[row].size(); ++col) {
+            const Item& item = items[row][col];
+            if (item.type_ != NONE) {
+                weight_ += item.weight_;
+                item_count_++;
+            }
+            cells[row * cols_ + col] = item;
+        }
     }
+}
 
-    weight_ = 0;
-    item_count_ = 0;
-
-    // iterates through items to update total weight_ and item_count
-    for (auto item_row : items) {
-        for (auto item : item_row) {
+/**
+ * @brief Constructor from a 2D vector of items, moving the items out of it.
+ * @param items An r-value ref. to a 2D vector of items, one inner vector per row.
+ * @param equipped A pointer to an Item object. 
+ *  Defaults to nullptr, if none provided.
+ * 
+ * @post As for the const ref. constructor, but no Item name is copied.
+ */
+Inventory::Inventory(std::vector<std::vector<Item>>&& items, Item* equipped) : Inventory(items.size(), widest(items), equipped) {
+    std::vector<Item>& cells = mutableGrid();
+    for (size_t row = 0; row < rows_; ++row) {
+        for (size_t col = 0; col < items[row].size(); ++col) {
+            Item& item = items[row][col];
             if (item.type_ != NONE) {
                 weight_ += item.weight_;
                 item_count_++;
-            } 
+            }
+            cells[row * cols_ + col] = std::move(item);
         }
     }
 }
 
+/**
+ * @brief Finds the length of the longest row of a 2D vector of items.
+ * @param items A const reference to a 2D vector of items.
+ * @return The number of columns needed to hold every row.
+ */
+size_t Inventory::widest(const std::vector<std::vector<Item>>& items) {
+    size_t cols = 0;
+    for (const auto& item_row : items) {
+        cols = std::max(cols, item_row.size());
+    }
+    return cols;
+}
+
+/**
+ * @brief Allocates a grid of default-constructed items.
+ * @param cells The number of items, i.e. rows * columns.
+ */
+Inventory::Grid Inventory::makeGrid(const size_t& cells) {
+#ifdef INVENTORY_COPY_ON_WRITE
+    return std::make_shared<std::vector<Item>>(cells);
+#else
+    return Grid(cells);
+#endif
+}
+
+/**
+ * @brief Retrieves the items of the grid, for reading.
+ * @return A const ref. to the row-major buffer (empty if this Inventory was moved from).
+ */
+const std::vector<Item>& Inventory::grid() const {
+#ifdef INVENTORY_COPY_ON_WRITE
+    static const std::vector<Item> empty;
+    return inventory_grid_ ? *inventory_grid_ : empty;
+#else
+    return inventory_grid_;
+#endif
+}
+
+/**
+ * @brief Retrieves the items of the grid, for writing.
+ * @return A ref. to the row-major buffer.
+ * @post With INVENTORY_COPY_ON_WRITE, if the buffer is shared with another
+ *  Inventory, this one first gets its own copy of it, so writes never
+ *  show through to the copies.
+ */
+std::vector<Item>& Inventory::mutableGrid() {
+#ifdef INVENTORY_COPY_ON_WRITE
+    // NOTE: use_count() is only exact while no other thread copies or drops this grid
+    if (!inventory_grid_) {
+        inventory_grid_ = std::make_shared<std::vector<Item>>();
+    } else if (inventory_grid_.use_count() > 1) {
+        inventory_grid_ = std::make_shared<std::vector<Item>>(*inventory_grid_);
+    }
+    return *inventory_grid_;
+#else
+    return inventory_grid_;
+#endif
+}
+
 /** 
  * @brief Retrieves the value stored in `equipped_`
  * @return The Item pointer stored in `equipped_`
@@ -89,11 +185,33 @@ void Inventory::discardEquipped() {
 }
 
 /** 
- * @brief Retrieves the value stored in `inventory_grid_`
- * @return The vector<vector<Item>> value stored in `inventory_grid_`
+ * @brief Retrieves the items stored in `inventory_grid_`, one vector per row
+ * @return A vector<vector<Item>> copy of the grid
  */
 std::vector<std::vector<Item>> Inventory::getItems() const {
-    return inventory_grid_;
+    std::vector<std::vector<Item>> items;
+    items.reserve(rows_);
+    for (size_t row = 0; row < rows_; ++row) {
+        auto begin = grid().begin() + row * cols_;
+        items.emplace_back(begin, begin + cols_);
+    }
+    return items;
+}
+
+/**
+ * @brief Retrieves the number of rows in the grid
+ * @return The size_t value stored in `rows_`
+ */
+size_t Inventory::getRows() const {
+    return rows_;
+}
+
+/**
+ * @brief Retrieves the number of columns in the grid
+ * @return The size_t value stored in `cols_`
+ */
+size_t Inventory::getCols() const {
+    return cols_;
 }
 
 /** 
@@ -118,15 +236,15 @@ size_t Inventory::getCount() const {
  *
  * @param row A size_t parameter for the row index in the inventory grid.
  * @param col A size_t parameter for the column index in the inventory grid.
- * @return The item at the specified row and column.
+ * @return A const ref. to the item at the specified row and column.
  * @throws std::out_of_range If the row or column is out of bounds.
  */
-Item Inventory::at(const size_t& row, const size_t& col) const {
+const Item& Inventory::at(const size_t& row, const size_t& col) const {
     // if invalid number for row or col
-    if ((row >= inventory_grid_.size() || row < 0) || ((col >= inventory_grid_[row].size()) || col < 0)) {
+    if (row >= rows_ || col >= cols_) {
         throw std::out_of_range("Row or Column out of range");
     }
-    return inventory_grid_[row][col];
+    return grid()[row * cols_ + col];
 }
 
 /**
@@ -143,13 +261,13 @@ Item Inventory::at(const size_t& row, const size_t& col) const {
 bool Inventory::store(const size_t& row, const size_t& col, const Item& pickup) {
     // check row, then col.
     // only throw exception
-    if ((row >= inventory_grid_.size() || row < 0) || ((col >= inventory_grid_[row].size()) || col < 0)) {
+    if (row >= rows_ || col >= cols_) {
         throw std::out_of_range("Row or Column out of range");
     }
 
-    if (inventory_grid_[row][col].type_ == NONE) {
-        // throw std::out_of_range("Row or Column out of range");
-        inventory_grid_[row][col] = pickup; 
+    // only a successful store writes to (and so may unshare) the grid
+    if (grid()[row * cols_ + col].type_ == NONE) {
+        mutableGrid()[row * cols_ + col] = pickup; 
         item_count_++;
         weight_ += pickup.weight_;
         return true;
@@ -157,6 +275,28 @@ bool Inventory::store(const size_t& row, const size_t& col, const Item& pickup)
     return false;
 }
 
+/**
+ * @brief Stores an item at the specified row and column in the inventory grid,
+ * moving it into the cell instead of copying it.
+ *
+ * @param pickup An r-value ref. to the item to store. It is only moved from
+ *  if it was successfully stored.
+ * @see store(const size_t&, const size_t&, const Item&)
+ */
+bool Inventory::store(const size_t& row, const size_t& col, Item&& pickup) {
+    if (row >= rows_ || col >= cols_) {
+        throw std::out_of_range("Row or Column out of range");
+    }
+
+    if (grid()[row * cols_ + col].type_ == NONE) {
+        item_count_++;
+        weight_ += pickup.weight_;
+        mutableGrid()[row * cols_ + col] = std::move(pickup);
+        return true;
+    }
+    return false;
+}
+
 // Big Five
 
 /**
@@ -165,8 +305,10 @@ bool Inventory::store(const size_t& row, const size_t& col, const Item& pickup)
  * @post Creates a deep copy of `rhs`, 
  *  including duplicating the dynamically 
  *  allocated item in `equipped`.
+ *  With INVENTORY_COPY_ON_WRITE, the grid is shared instead, until either
+ *  Inventory stores an item.
  */
-Inventory::Inventory(const Inventory& rhs) {
+Inventory::Inventory(const Inventory& rhs) : inventory_grid_(rhs.inventory_grid_), rows_(rhs.rows_), cols_(rhs.cols_) {
     if (rhs.equipped_ != nullptr) {
         // equipped_ = new Item(*rhs.equipped_);
         equipped_ = new Item;
@@ -175,7 +317,6 @@ Inventory::Inventory(const Inventory& rhs) {
         equipped_ = nullptr;
     }
 
-    inventory_grid_ = rhs.inventory_grid_;
     weight_ = rhs.weight_;
     item_count_ = rhs.item_count_;
 }
@@ -197,9 +338,7 @@ Inventory::Inventory(const Inventory& rhs) {
  * transferring ownership of the resource it points to.
  * 
  */
-Inventory::Inventory(Inventory && rhs) {
-    inventory_grid_ = std::move(rhs.inventory_grid_);
-
+Inventory::Inventory(Inventory && rhs) : inventory_grid_(std::move(rhs.inventory_grid_)), rows_(rhs.rows_), cols_(rhs.cols_) {
     if (rhs.equipped_ != nullptr) {
         equipped_ = rhs.equipped_;
         rhs.equipped_ = nullptr;
@@ -209,7 +348,9 @@ Inventory::Inventory(Inventory && rhs) {
     weight_ = std::move(rhs.weight_);
     item_count_ = std::move(rhs.item_count_);
 
-    rhs.inventory_grid_.clear();
+    rhs.inventory_grid_ = Grid();
+    rhs.rows_ = 0;
+    rhs.cols_ = 0;
     rhs.weight_ = 0.0;
     rhs.item_count_ = 0;
 }
@@ -220,6 +361,7 @@ Inventory::Inventory(Inventory && rhs) {
  * @return A reference to the updated Inventory object.
  * @post Performs a deep copy of `rhs`, including 
  * re-allocating and copying the item in `equipped`.
+ * With INVENTORY_COPY_ON_WRITE, the grid is shared instead.
  * 
  * NOTE: The resources of the overridden object
  * should be destroyed.
@@ -228,6 +370,8 @@ Inventory& Inventory::operator=(const Inventory& rhs) {
     if (this != &rhs) {
 
         inventory_grid_ = rhs.inventory_grid_;
+        rows_ = rhs.rows_;
+        cols_ = rhs.cols_;
 
         discardEquipped();
         if (rhs.equipped_ != nullptr) {
@@ -260,6 +404,8 @@ Inventory& Inventory::operator=(Inventory&& rhs) {
 
     if (this != &rhs) {
         inventory_grid_ = std::move(rhs.inventory_grid_);
+        rows_ = rhs.rows_;
+        cols_ = rhs.cols_;
 
         discardEquipped();
         if (rhs.equipped_ != nullptr) {
@@ -271,7 +417,9 @@ Inventory& Inventory::operator=(Inventory&& rhs) {
         item_count_ = rhs.item_count_;
 
         // reset rhs
-        rhs.inventory_grid_.clear();
+        rhs.inventory_grid_ = Grid();
+        rhs.rows_ = 0;
+        rhs.cols_ = 0;
         rhs.weight_ = 0.0;
         rhs.item_count_ = 0;
     }
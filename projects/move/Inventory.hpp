@@ -3,13 +3,38 @@
 #include <vector>
 #include "Item.hpp"
 
+// Uncomment the following line (or compile with -DINVENTORY_COPY_ON_WRITE) to share the
+// grid between copies of an Inventory (& so of a Player) behind a reference-counted handle.
+// Copying an Inventory then costs a reference count increment instead of copying every Item,
+// & the grid is only duplicated by the first store() into a copy that still shares it.
+// #define INVENTORY_COPY_ON_WRITE
+
+#ifdef INVENTORY_COPY_ON_WRITE
+#include <memory>
+#endif
+
 class Inventory {
     private: 
+#ifdef INVENTORY_COPY_ON_WRITE
+        using Grid = std::shared_ptr<std::vector<Item>>;
+#else
+        using Grid = std::vector<Item>;
+#endif
+
         /** A dynamic grid for storing non-equipped items.
-        * Each outer vector represents a row in the grid,
-        * while the inner vectors represent columns within those rows.
+        * The rows are stored back to back in one contiguous buffer (row-major),
+        * so the item at (row, col) is grid()[row * cols_ + col],
+        * and a whole grid costs a single allocation.
+        *
+        * With INVENTORY_COPY_ON_WRITE, this is a handle to a buffer that may be
+        * shared with copies of this Inventory; read it through grid(), & write it
+        * through mutableGrid().
         */
-        std::vector<std::vector<Item>> inventory_grid_;
+        Grid inventory_grid_;
+
+        // The number of rows & columns in `inventory_grid_`
+        size_t rows_;
+        size_t cols_;
         
         // A pointer to a dynamically allocated Item outside of the Player's bag
         Item* equipped_;
@@ -19,11 +44,58 @@ class Inventory {
 
         // The total number of non-empty items in `inventory_grid_`
         size_t item_count_;
+
+        /**
+         * @brief Finds the length of the longest row of a 2D vector of items.
+         * @param items A const reference to a 2D vector of items.
+         * @return The number of columns needed to hold every row.
+         */
+        static size_t widest(const std::vector<std::vector<Item>>& items);
+
+        /**
+         * @brief Allocates a grid of default-constructed items.
+         * @param cells The number of items, i.e. rows * columns.
+         */
+        static Grid makeGrid(const size_t& cells);
+
+        /**
+         * @brief Retrieves the items of the grid, for reading.
+         * @return A const ref. to the row-major buffer (empty if this Inventory was moved from).
+         */
+        const std::vector<Item>& grid() const;
+
+        /**
+         * @brief Retrieves the items of the grid, for writing.
+         * @return A ref. to the row-major buffer.
+         * @post With INVENTORY_COPY_ON_WRITE, if the buffer is shared with another
+         *  Inventory, this one first gets its own copy of it, so writes never
+         *  show through to the copies.
+         */
+        std::vector<Item>& mutableGrid();
     public:
         /**
-         * @brief Constructor with optional parameters for initialization.
-         * @param items A const reference to a 2D vector of items. 
-         *  Defaults to a 10x10 grid of default-constructed items, if none provided.
+         * @brief Constructs an empty 10 x 10 grid of default-constructed items,
+         *  with nothing equipped.
+         */
+        Inventory();
+
+        /**
+         * @brief Constructs an empty grid of default-constructed items.
+         * @param rows The number of rows.
+         * @param cols The number of columns. Defaults to 10, if none provided.
+         * @param equipped A pointer to an Item object. 
+         *  Defaults to nullptr, if none provided.
+         * 
+         * @post `weight_` and `item_count_` are 0.
+         * 
+         * NOTE: Explicit, so that a number is never silently converted to an Inventory.
+         */
+        explicit Inventory(const size_t& rows, const size_t& cols = 10, Item* equipped = nullptr);
+
+        /**
+         * @brief Constructor from a 2D vector of items.
+         * @param items A const reference to a 2D vector of items, one inner vector per row.
+         *  Rows shorter than the longest are padded with default-constructed items.
          * @param equipped A pointer to an Item object. 
          *  Defaults to nullptr, if none provided.
          * 
@@ -33,11 +105,17 @@ class Inventory {
          * 
          * NOTE: The `equipped` item is excluded from these calculations.
          */
-        Inventory(
-            const std::vector<std::vector<Item>>& items = 
-                std::vector(10, std::vector<Item>(10, Item{})),
-            Item* equipped = nullptr
-            );
+        Inventory(const std::vector<std::vector<Item>>& items, Item* equipped = nullptr);
+
+        /**
+         * @brief Constructor from a 2D vector of items, moving the items out of it.
+         * @param items An r-value ref. to a 2D vector of items, one inner vector per row.
+         * @param equipped A pointer to an Item object. 
+         *  Defaults to nullptr, if none provided.
+         * 
+         * @post As for the const ref. constructor, but no Item name is copied.
+         */
+        Inventory(std::vector<std::vector<Item>>&& items, Item* equipped = nullptr);
 
         /** 
          * @brief Retrieves the value stored in `equipped_`
@@ -61,11 +139,23 @@ class Inventory {
         void discardEquipped();
 
         /** 
-         * @brief Retrieves the value stored in `inventory_grid_`
-         * @return The vector<vector<Item>> value stored in `inventory_grid_`
+         * @brief Retrieves the items stored in `inventory_grid_`, one vector per row
+         * @return A vector<vector<Item>> copy of the grid
          */
         std::vector<std::vector<Item>> getItems() const;
 
+        /**
+         * @brief Retrieves the number of rows in the grid
+         * @return The size_t value stored in `rows_`
+         */
+        size_t getRows() const;
+
+        /**
+         * @brief Retrieves the number of columns in the grid
+         * @return The size_t value stored in `cols_`
+         */
+        size_t getCols() const;
+
         /** 
          * @brief Retrieves the value stored in `weight_`
          * @return The float value stored in `weight_`
@@ -84,10 +174,10 @@ class Inventory {
          *
          * @param row A size_t parameter for the row index in the inventory grid.
          * @param col A size_t parameter for the column index in the inventory grid.
-         * @return The item at the specified row and column.
+         * @return A const ref. to the item at the specified row and column.
          * @throws std::out_of_range If the row or column is out of bounds.
          */
-        Item at(const size_t& row, const size_t& col) const;
+        const Item& at(const size_t& row, const size_t& col) const;
 
         /**
          * @brief Stores an item at the specified row and column in the inventory grid.
@@ -102,6 +192,16 @@ class Inventory {
          */
         bool store(const size_t& row, const size_t& col, const Item& pickup);
 
+        /**
+         * @brief Stores an item at the specified row and column in the inventory grid,
+         * moving it into the cell instead of copying it.
+         *
+         * @param pickup An r-value ref. to the item to store. It is only moved from
+         *  if it was successfully stored.
+         * @see store(const size_t&, const size_t&, const Item&)
+         */
+        bool store(const size_t& row, const size_t& col, Item&& pickup);
+
         // Big Five
 
         /**
@@ -110,6 +210,8 @@ class Inventory {
          * @post Creates a deep copy of `rhs`, 
          *  including duplicating the dynamically 
          *  allocated item in `equipped`.
+         *  With INVENTORY_COPY_ON_WRITE, the grid is shared instead, until either
+         *  Inventory stores an item.
          */
         Inventory(const Inventory& rhs);
 
@@ -132,6 +234,7 @@ class Inventory {
          * @return A reference to the updated Inventory object.
          * @post Performs a deep copy of `rhs`, including 
          * re-allocating and copying the item in `equipped`.
+         * With INVENTORY_COPY_ON_WRITE, the grid is shared instead.
          * 
          * NOTE: The resources of the overridden object
          * should be destroyed.
@@ -5,14 +5,16 @@
 */
 
 #include "Player.hpp"
+#include <utility>
 
 /**
  * @brief Constructs a Player with the given identifier.
- * @param name A const. string reference to be the player name
- * @param inventory A const ref. to an Inventory to copy and setup a Player's inventory_ member
+ * @param name The player name, taken by value & moved into name_
+ * @param inventory An Inventory to setup a Player's inventory_ member, taken by value
+ *      & moved in, so passing an r-value (or the default) never copies the grid.
  *      If none provided, default value of a default constructed Inventory
  */
-Player::Player(const std::string& name, const Inventory& inventory) : inventory_(inventory), name_(name) {}
+Player::Player(std::string name, Inventory inventory) : inventory_(std::move(inventory)), name_(std::move(name)) {}
 
 /**
  * @brief Gets the name of the Player
@@ -37,12 +39,7 @@ Inventory& Player::getInventoryRef() {
  * @param rhs A const l-value ref. to the Player object to copy.
  * @post Creates a deep copy of `rhs`
  */
-Player::Player(const Player& rhs) {
-  if (this != &rhs) {
-    name_ = rhs.name_;
-    inventory_ = rhs.inventory_;  
-  }
-}
+Player::Player(const Player& rhs) : inventory_(rhs.inventory_), name_(rhs.name_) {}
 
   /**
  * @brief Move constructor for the Player class.
@@ -50,12 +47,7 @@ Player::Player(const Player& rhs) {
  * @post Transfers ownership of resources from `rhs`
  * to the newly constructed Player object *using move semantics*
  */
-Player::Player(Player&& rhs) {
-  if (this != &rhs) {
-    name_ = std::move(rhs.name_);
-    inventory_ = std::move(rhs.inventory_);
-  }
-}
+Player::Player(Player&& rhs) : inventory_(std::move(rhs.inventory_)), name_(std::move(rhs.name_)) {}
 
 /**
  * @brief Copy assignment operator for the Player class.
@@ -81,7 +73,7 @@ Player& Player::operator=(const Player& rhs) {
  */
 Player& Player::operator=(Player&& rhs) {
   if (this != &rhs) {
-    name_ = rhs.name_;
+    name_ = std::move(rhs.name_);
     inventory_ = std::move(rhs.inventory_); // previously used swap
   }
   return *this;
@@ -10,11 +10,12 @@ class Player {
     public:
         /**
          * @brief Constructs a Player with the given identifier.
-         * @param name A const. string reference to be the player name
-         * @param inventory A const ref. to an Inventory to copy and setup a Player's inventory_ member
+         * @param name The player name, taken by value & moved into name_
+         * @param inventory An Inventory to setup a Player's inventory_ member, taken by value
+         *      & moved in, so passing an r-value (or the default) never copies the grid.
          *      If none provided, default value of a default constructed Inventory
          */
-        Player(const std::string& name, const Inventory& inventory = Inventory());
+        Player(std::string name, Inventory inventory = Inventory());
         
         /**
          * @brief Gets the name of the Player
@@ -44,7 +44,7 @@ RankingResult::RankingResult(const std::vector<Player>& top, const std::unordere
 */
 void Online::replaceMin(PlayerIt first, PlayerIt last, Player& target) {
     // replace the first value with the target
-    *first = target;
+    *first = std::move(target);
     // std::cout << "\n new_min" << target.level_;
     Online::percolateDown(first, first, last, false);
 
@@ -70,7 +70,8 @@ void Online::percolateDown(PlayerIt root, PlayerIt start, PlayerIt end, bool max
     auto itr = root;
     auto i = std::distance(start,itr);
 
-    auto temp = *root;
+    // only the level is compared, so don't copy the whole Player (and its name)
+    const size_t temp = root->level_;
     PlayerIt child;
 
     // while (itr + 2*i < end) {
@@ -90,9 +91,9 @@ void Online::percolateDown(PlayerIt root, PlayerIt start, PlayerIt end, bool max
 
         // std::cout << " child" << std::distance(root, child) << "-" << (*child).level_;
 
-        if (max && *child > temp) {
+        if (max && child->level_ > temp) {
             std::iter_swap(itr,child);
-        } else if (!max && *child < temp) {
+        } else if (!max && child->level_ < temp) {
             // std::cout << " swap" << (*child).level_ << "<->" << temp.level_;
             std::iter_swap(itr,child);
         } else {
@@ -117,6 +118,8 @@ void Online::percolateDown(PlayerIt root, PlayerIt start, PlayerIt end, bool max
 *
 * @note You should use NOT use a priority-queue.
 *       Instead, use a vector, the STL heap operations, & `replaceMin()`
+* @note The stream is read BATCH_SIZE Players at a time through nextBatch(),
+*       moving each Player into the heap instead of copying it.
 *
 * @param stream A stream providing Player objects
 * @param reporting_interval The frequency at which to record cutoff levels
@@ -143,58 +146,65 @@ void Online::percolateDown(PlayerIt root, PlayerIt start, PlayerIt end, bool max
 RankingResult Online::rankIncoming(PlayerStream& stream, const size_t& reporting_interval) {
     auto start = std::chrono::high_resolution_clock::now();
 
-    Player current_player;
     size_t read = 0;
 
     std::vector<Player> min_top; 
     std::unordered_map<size_t, size_t> cutoffs_;
 
-    while (stream.remaining() > 0) {
-        current_player = stream.nextPlayer();
-        read++;
-        // players_streamed.push_back(current_player);
-
-        // std::cout << "READ"<<read;
-        if (read < reporting_interval) {
-            min_top.push_back(current_player);
-
-        } else if (read == reporting_interval) {
-            min_top.push_back(current_player);
-
-            // std::cout << "\nvector: ";
-            // if (min_top.size() > 1) {
-            //     PlayerIt itr = min_top.begin();
-            //     while (itr != min_top.end()) {
-            //         std::cout << (*itr).name_[0] << (*itr).level_ << " ";
-            //         itr++;
-            //     }
-            // }
-            // std::cout << "\n";
-
-            std::make_heap(min_top.begin(), min_top.end(), std::greater<Player>());
-            // Online::buildHeap(min_top.begin(), min_top.end());
-
-            // std::cout << "\nMAKE HEAP: ";
-            // if (min_top.size() > 1) {
-            //     PlayerIt itr = min_top.begin();
-            //     while (itr != min_top.end()) {
-            //         std::cout << (*itr).name_[0] << (*itr).level_ << " ";
-            //         itr++;
-            //     }
-            // }
-        } else {
-            // if next player has higher score than player on leaderboard, replace min
-            if (current_player.level_ >= min_top.front().level_) {
-                Online::replaceMin(min_top.begin(), min_top.end(), current_player);
+    // read the stream a block at a time, reusing one buffer
+    std::vector<Player> block;
+    block.reserve(Online::BATCH_SIZE);
+
+    while (stream.nextBatch(block, Online::BATCH_SIZE) > 0) {
+        for (Player& current_player : block) {
+            read++;
+            // players_streamed.push_back(current_player);
+
+            // std::cout << "READ"<<read;
+            if (read < reporting_interval) {
+                min_top.push_back(std::move(current_player));
+
+            } else if (read == reporting_interval) {
+                min_top.push_back(std::move(current_player));
+
+                // std::cout << "\nvector: ";
+                // if (min_top.size() > 1) {
+                //     PlayerIt itr = min_top.begin();
+                //     while (itr != min_top.end()) {
+                //         std::cout << (*itr).name_[0] << (*itr).level_ << " ";
+                //         itr++;
+                //     }
+                // }
+                // std::cout << "\n";
+
+                std::make_heap(min_top.begin(), min_top.end(), std::greater<Player>());
+                // Online::buildHeap(min_top.begin(), min_top.end());
+
+                // std::cout << "\nMAKE HEAP: ";
+                // if (min_top.size() > 1) {
+                //     PlayerIt itr = min_top.begin();
+                //     while (itr != min_top.end()) {
+                //         std::cout << (*itr).name_[0] << (*itr).level_ << " ";
+                //         itr++;
+                //     }
+                // }
+            } else {
+                // if next player has higher score than player on leaderboard, replace min
+                if (current_player.level_ >= min_top.front().level_) {
+                    Online::replaceMin(min_top.begin(), min_top.end(), current_player);
+                }
             }
-        }
 
-        if (read % reporting_interval == 0 && !min_top.empty()) {
-            cutoffs_.insert({read,min_top[0].level_});
+            if (read % reporting_interval == 0 && !min_top.empty()) {
+                cutoffs_.insert({read,min_top[0].level_});
+            }
         }
     }
 
-    cutoffs_.insert({read, min_top[0].level_});
+    if (!min_top.empty()) {
+        // A stream shorter than reporting_interval never made min_top a heap, so find its minimum
+        cutoffs_.insert({read, std::min_element(min_top.begin(), min_top.end())->level_});
+    }
 
     // std::cout << "\nview HEAP: ";
     // if (min_top.size() > 1) {
@@ -213,6 +223,227 @@ RankingResult Online::rankIncoming(PlayerStream& stream, const size_t& reporting
     return RankingResult(min_top,cutoffs_,std::chrono::duration<double>(end-start).count());
 }
 
+/**
+ * @brief Computes the same RankingResult as rankIncoming(), sharding the work across threads.
+ *
+ * The stream is read one reporting interval at a time. Each interval is split into
+ * `workers` contiguous shards, & every worker keeps only the players of its shard at or
+ * above the current cutoff (no other player can make the leaderboard, since the cutoff
+ * never decreases). At the interval's boundary, the survivors are merged with the current
+ * leaderboard using std::nth_element, which gives the new leaderboard & its cutoff.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels
+ * @param workers The number of threads to shard each interval across (including the calling thread)
+ * @return A RankingResult as described in rankIncoming(), with the same top_ levels & cutoffs_.
+ *      Players tied on level at the cutoff may differ.
+ *
+ * @note Falls back to rankIncoming() if workers <= 1, or if an interval is too small to give
+ *       every worker MIN_SHARD_SIZE players.
+ * @post All elements of the stream are read until there are none remaining.
+ */
+RankingResult Online::rankIncomingParallel(PlayerStream& stream, const size_t& reporting_interval, const size_t& workers) {
+    if (workers <= 1 || reporting_interval / workers < Online::MIN_SHARD_SIZE) {
+        return Online::rankIncoming(stream, reporting_interval);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t read = 0;
+    size_t cutoff = 0; // the lowest level on a full leaderboard, 0 until it fills
+
+    std::vector<Player> top;
+    top.reserve(2 * reporting_interval);
+    std::unordered_map<size_t, size_t> cutoffs_;
+
+    std::vector<Player> block, chunk;
+    std::vector<std::vector<Player>> survivors(workers);
+    std::vector<std::future<void>> shards(workers - 1);
+
+    while (true) {
+        // read exactly one interval (or whatever is left of the stream)
+        block.clear();
+        while (block.size() < reporting_interval && stream.nextBatch(chunk, reporting_interval - block.size()) > 0) {
+            if (block.empty()) {
+                block.swap(chunk);
+            } else {
+                block.insert(block.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+            }
+        }
+        if (block.empty()) {
+            break;
+        }
+        read += block.size();
+
+        // filter each shard against the cutoff, in parallel
+        auto filter = [&](size_t w) {
+            auto first = block.begin() + block.size() * w / workers;
+            auto last = block.begin() + block.size() * (w + 1) / workers;
+            survivors[w].clear();
+            for (; first != last; ++first) {
+                if (first->level_ >= cutoff) {
+                    survivors[w].push_back(std::move(*first));
+                }
+            }
+        };
+        for (size_t w = 1; w < workers; ++w) {
+            shards[w - 1] = std::async(std::launch::async, filter, w);
+        }
+        filter(0);
+        for (auto& shard : shards) {
+            shard.get();
+        }
+
+        // merge the survivors into the leaderboard, keeping the highest reporting_interval
+        for (auto& shard_survivors : survivors) {
+            top.insert(top.end(), std::make_move_iterator(shard_survivors.begin()), std::make_move_iterator(shard_survivors.end()));
+        }
+        if (top.size() > reporting_interval) {
+            std::nth_element(top.begin(), top.begin() + (reporting_interval - 1), top.end(), std::greater<Player>());
+            top.resize(reporting_interval);
+        }
+
+        size_t lowest = std::min_element(top.begin(), top.end())->level_;
+        if (top.size() == reporting_interval) {
+            cutoff = lowest;
+        }
+        if (read % reporting_interval == 0 || block.size() < reporting_interval) {
+            cutoffs_.insert({read, lowest});
+        }
+    }
+
+    std::sort(top.begin(), top.end());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return RankingResult(top,cutoffs_,std::chrono::duration<double>(end-start).count());
+}
+
+/**
+ * @brief Exhausts a stream of Players like rankIncoming(), but ranks only the `window`
+ *        most recently read players, so the leaderboard & its cutoffs follow recent form.
+ *
+ * The window is a ring of its `window` players, & their (level, arrival) keys are split
+ * between two ordered sets: the <reporting_interval> highest, & the rest. Each new player
+ * expires the oldest one from whichever set holds it, enters one of the sets, & at most one
+ * key moves across to keep the first set full.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels, & the size of the leaderboard
+ * @param window The number of most recent players to rank over
+ * @return A RankingResult as described in rankIncoming(), over the last <window> players only.
+ *
+ * @note If window < reporting_interval, the leaderboard is the whole window.
+ * @throws std::invalid_argument If window is 0; nothing is read from the stream then.
+ * @post All elements of the stream are read until there are none remaining.
+ */
+RankingResult Online::rankWindowed(PlayerStream& stream, const size_t& reporting_interval, const size_t& window) {
+    if (window == 0) {
+        throw std::invalid_argument("rankWindowed window must be at least 1");
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    using Key = std::pair<size_t, size_t>; // (level, arrival), so equal levels stay distinct
+
+    size_t read = 0;
+    std::vector<Player> ring; // the window, where player i is at i % window
+    ring.reserve(std::min(window, Online::BATCH_SIZE));
+
+    std::set<Key> top, rest; // the highest <reporting_interval> keys of the window, & the others
+    std::unordered_map<size_t, size_t> cutoffs_;
+
+    std::vector<Player> block;
+    block.reserve(Online::BATCH_SIZE);
+
+    while (stream.nextBatch(block, Online::BATCH_SIZE) > 0) {
+        for (Player& current_player : block) {
+            Key key(current_player.level_, read);
+
+            // expire the player leaving the window, refilling top from rest if it was there
+            if (read >= window) {
+                Key expired(ring[read % window].level_, read - window);
+                if (top.erase(expired) == 0) {
+                    rest.erase(expired);
+                } else if (!rest.empty()) {
+                    top.insert(*std::prev(rest.end()));
+                    rest.erase(std::prev(rest.end()));
+                }
+                ring[read % window] = std::move(current_player);
+            } else {
+                ring.push_back(std::move(current_player));
+            }
+
+            if (top.size() < reporting_interval || *top.begin() < key) {
+                top.insert(key);
+                if (top.size() > reporting_interval) {
+                    rest.insert(*top.begin());
+                    top.erase(top.begin());
+                }
+            } else {
+                rest.insert(key);
+            }
+
+            read++;
+            if (read % reporting_interval == 0) {
+                cutoffs_.insert({read, top.begin()->first});
+            }
+        }
+    }
+
+    std::vector<Player> window_top;
+    if (!top.empty()) {
+        cutoffs_.insert({read, top.begin()->first});
+
+        window_top.reserve(top.size());
+        for (const Key& key : top) {
+            window_top.push_back(std::move(ring[key.second % window]));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return RankingResult(window_top,cutoffs_,std::chrono::duration<double>(end-start).count());
+}
+
+/**
+ * @brief Exhausts a stream of Players into a QuantileSketch of their levels, recording an
+ *        approximate cutoff every <reporting_interval> players instead of an exact one.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels
+ * @param sketch The sketch to add every level read to
+ * @param q The quantile to report as the cutoff, e.g. 0.9 for the top 10%
+ * @return A RankingResult whose cutoffs_ map player count milestones to the approximate
+ *      q-quantile of the levels read by then, & whose top_ is empty.
+ *
+ * @post All elements of the stream are read until there are none remaining.
+ */
+RankingResult Online::sketchIncoming(PlayerStream& stream, const size_t& reporting_interval, QuantileSketch& sketch, const double& q) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t read = 0;
+    std::unordered_map<size_t, size_t> cutoffs_;
+
+    std::vector<Player> block;
+    block.reserve(Online::BATCH_SIZE);
+
+    while (stream.nextBatch(block, Online::BATCH_SIZE) > 0) {
+        for (const Player& current_player : block) {
+            sketch.update(current_player.level_);
+            read++;
+            if (read % reporting_interval == 0) {
+                cutoffs_.insert({read, sketch.quantile(q)});
+            }
+        }
+    }
+
+    if (sketch.count() > 0) {
+        cutoffs_.insert({read, sketch.quantile(q)});
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    return RankingResult({},cutoffs_,std::chrono::duration<double>(end-start).count());
+}
+
 /**
  * @brief buildHeaps min heap with percolateDown/
  * 
@@ -344,6 +575,122 @@ RankingResult Offline::quickSelectRank(std::vector<Player>& players) { // o(n^2)
     return RankingResult(std::vector<Player>(players.begin(),players.begin()+top_10),{},std::chrono::duration<double>(end-start).count());
 }
 
+/**
+ * @brief Uses introselect & a task-parallel quicksort to
+ *        select and sort the top 10% of players in-place
+ *        (excluding the returned RankingResult vector)
+ *
+ * @param players A reference to the vector of Player objects to be ranked
+ * @param tasks The maximum number of threads sorting the top 10% at once
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players from the input in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of the selection/sorting operation
+ *
+ * @post The order of the parameter vector is modified.
+ */
+RankingResult Offline::introSelectRank(std::vector<Player>& players, const size_t& tasks) {
+    size_t top_10 = std::floor(0.1 * players.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (top_10 > 0) {
+        // the top 10% end up in [begin, begin + top_10), in no particular order
+        Offline::introSelect(players.begin(), players.begin(), players.begin() + (top_10 - 1), players.end());
+
+        Offline::parallelSort(players.begin(), players.begin() + top_10, tasks);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return RankingResult(std::vector<Player>(players.begin(),players.begin()+top_10),{},std::chrono::duration<double>(end-start).count());
+}
+
+/**
+ * @brief Selects and sorts the top 10% of players by working on PlayerKeys
+ *        rather than on the Players themselves
+ *
+ * @param players A reference to the vector of Player objects to be ranked
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players from the input in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of building, selecting & sorting the keys & gathering top_
+ *
+ * @note Unlike the other Offline rankers, the parameter vector is left unchanged.
+ */
+RankingResult Offline::keyRank(const std::vector<Player>& players) {
+    size_t top_10 = std::floor(0.1 * players.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<Player> top;
+    if (top_10 > 0) {
+        std::vector<PlayerKey> keys(players.size());
+        for (size_t i = 0; i < players.size(); ++i) {
+            keys[i] = { players[i].level_, i };
+        }
+
+        Offline::selectTopKeys(keys, top_10);
+
+        // gather the full Players, in order
+        top.reserve(top_10);
+        for (size_t i = 0; i < top_10; ++i) {
+            top.push_back(players[keys[i].index_]);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return RankingResult(top,{},std::chrono::duration<double>(end-start).count());
+}
+
+/**
+ * @brief Selects and sorts the top 10% of the players of a PlayerSnapshot,
+ *        reading their levels straight from the mapped records
+ *
+ * @param snapshot The mapped snapshot whose players are to be ranked
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players of the snapshot in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of building, selecting & sorting the keys & gathering top_
+ */
+RankingResult Offline::snapshotRank(const PlayerSnapshot& snapshot) {
+    size_t top_10 = std::floor(0.1 * snapshot.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<Player> top;
+    if (top_10 > 0) {
+        const PlayerRecord* records = snapshot.records();
+        std::vector<PlayerKey> keys(snapshot.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = { records[i].level_, i };
+        }
+
+        Offline::selectTopKeys(keys, top_10);
+
+        // only now build full Players, in order
+        top.reserve(top_10);
+        for (size_t i = 0; i < top_10; ++i) {
+            top.push_back(snapshot.player(keys[i].index_));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return RankingResult(top,{},std::chrono::duration<double>(end-start).count());
+}
+
+/**
+ * @brief Moves the `count` highest keys to the front of `keys`, in ascending order.
+ *
+ * @pre 0 < count <= keys.size()
+ */
+void Offline::selectTopKeys(std::vector<PlayerKey>& keys, const size_t& count) {
+    Offline::introSelect(keys.begin(), keys.begin(), keys.begin() + (count - 1), keys.end());
+    Offline::radixSortKeys(keys.data(), keys.data() + count);
+}
+
 /**
  * @brief Helper for the quickSort function.
  * 
@@ -447,3 +794,526 @@ void Offline::quickSort(std::vector<T>& array, int low, int high) {
         quickSort(array, pivot+1, high);
     }
 }
+
+/**
+ * @brief Partitions a range so that the players satisfying a predicate come first.
+ *
+ * Works on blocks of BLOCK players from both ends: a branch-free pass over each block
+ * records the offsets of the players on the wrong side, then only those are swapped
+ * in pairs. Comparisons never mispredict, & whole Players are only moved when misplaced.
+ *
+ * @param first An iterator to the beginning of the range
+ * @param last An iterator to one past the end of the range
+ * @param goes_left A predicate on a const Player&
+ * @return An iterator to the first player not satisfying `goes_left`
+ */
+template <typename It, typename Pred>
+It Offline::blockPartition(It first, It last, Pred goes_left) {
+    const int BLOCK = 64;
+    unsigned char offsets_l[BLOCK], offsets_r[BLOCK];
+    int num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (last - first > 2 * BLOCK) {
+        // players in the left block that belong on the right, & vice versa
+        if (num_l == 0) {
+            start_l = 0;
+            for (int i = 0; i < BLOCK; ++i) {
+                offsets_l[num_l] = i;
+                num_l += !goes_left(first[i]);
+            }
+        }
+        if (num_r == 0) {
+            start_r = 0;
+            for (int i = 0; i < BLOCK; ++i) {
+                offsets_r[num_r] = i;
+                num_r += goes_left(*(last - 1 - i));
+            }
+        }
+
+        int num = std::min(num_l, num_r);
+        for (int j = 0; j < num; ++j) {
+            std::iter_swap(first + offsets_l[start_l + j], last - 1 - offsets_r[start_r + j]);
+        }
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+
+        // a block with nothing left to swap is fully partitioned
+        if (num_l == 0) {
+            first += BLOCK;
+        }
+        if (num_r == 0) {
+            last -= BLOCK;
+        }
+    }
+
+    // finish the last few blocks one player at a time
+    while (true) {
+        while (first < last && goes_left(*first)) {
+            ++first;
+        }
+        while (first < last && !goes_left(*(last - 1))) {
+            --last;
+        }
+        if (first >= last) {
+            return first;
+        }
+        std::iter_swap(first, last - 1);
+        ++first;
+        --last;
+    }
+}
+
+/**
+ * @brief Moves a pivot for [first, last) to `first`: the median of 3 players
+ *        (or of 3 medians of 3, on larger ranges).
+ */
+template <typename It>
+void Offline::medianOfThreePivot(It first, It last) {
+    auto sort3 = [](It a, It b, It c) { // leaves the median level in b
+        if (b->level_ < a->level_) std::iter_swap(a, b);
+        if (c->level_ < b->level_) std::iter_swap(b, c);
+        if (b->level_ < a->level_) std::iter_swap(a, b);
+    };
+
+    auto n = last - first;
+    It mid = first + n / 2;
+    if (n > 128) {
+        auto step = n / 8;
+        sort3(first, first + step, first + 2 * step);
+        sort3(mid - step, mid, mid + step);
+        sort3(last - 1 - 2 * step, last - 1 - step, last - 1);
+        sort3(first + step, mid, last - 1 - step);
+    } else {
+        sort3(first, mid, last - 1);
+    }
+    std::iter_swap(first, mid);
+}
+
+/**
+ * @brief Moves a pivot for [first, last) to `first`, the median of the medians of groups of 5,
+ *        which guarantees both sides of the partition hold at least ~30% of the range.
+ *
+ * @param bad_partitions The budget left to the calling introSelect(), passed on to the one
+ *      selecting the median of the medians
+ */
+template <typename It>
+void Offline::medianOfMediansPivot(It first, It last, int bad_partitions) {
+    auto byLevel = [](const auto& a, const auto& b) { return a.level_ < b.level_; };
+
+    // gather the median of every group of 5 at the front of the range
+    It medians = first;
+    for (It group = first; last - group >= 5; group += 5) {
+        std::sort(group, group + 5, byLevel);
+        std::iter_swap(medians++, group + 2);
+    }
+    if (medians == first) { // fewer than 5 players
+        medians = last;
+    }
+
+    // A fresh budget per call would let bad median-of-3 partitions pile up with the recursion
+    It median = first + (medians - first) / 2;
+    Offline::introSelect(first, first, median, medians, bad_partitions);
+    std::iter_swap(first, median);
+}
+
+/**
+ * @brief Rearranges [first, last) so that `nth` holds the player it would in a sort by
+ *        descending level, all players before it rank at least as high, & all after at most as high.
+ *
+ * @param begin The beginning of the whole array; everything in [begin, first) must rank
+ *      at least as high as every player in [first, last)
+ * @param bad_partitions The number of median-of-3 partitions still allowed to keep more than
+ *      3/4 of their range; at 0, every pivot is a median of medians
+ */
+template <typename It>
+void Offline::introSelect(It begin, It first, It nth, It last, int bad_partitions) {
+    const int INSERTION_THRESHOLD = 16;
+
+    while (last - first > INSERTION_THRESHOLD) {
+        const auto size = last - first;
+        if (bad_partitions > 0) {
+            Offline::medianOfThreePivot(first, last);
+        } else {
+            Offline::medianOfMediansPivot(first, last, bad_partitions);
+        }
+        const size_t pivot = first->level_;
+
+        if (first != begin && (first - 1)->level_ == pivot) {
+            // If the player before this range ties with the pivot, no player here ranks higher,
+            // so split off every player tied with the pivot: they are all already in place.
+            It split = Offline::blockPartition(first + 1, last, [pivot](const auto& p) { return p.level_ >= pivot; });
+            if (nth < split) {
+                return;
+            }
+            first = split;
+        } else {
+            // higher levels to the left, the pivot between
+            It split = Offline::blockPartition(first + 1, last, [pivot](const auto& p) { return p.level_ > pivot; }) - 1;
+            std::iter_swap(first, split);
+
+            if (split == nth) {
+                return;
+            } else if (nth < split) {
+                last = split;
+            } else {
+                first = split + 1;
+            }
+        }
+
+        // Partitions keeping at most 3/4 shrink the range geometrically, so only the few
+        // allowed to keep more can cost more than O(N) in all
+        if (bad_partitions > 0 && 4 * (last - first) > 3 * size) {
+            bad_partitions--;
+        }
+    }
+
+    // insertion sort what's left, by descending level
+    for (It i = first; i < last; ++i) {
+        for (It j = i; j > first && (j - 1)->level_ < j->level_; --j) {
+            std::iter_swap(j - 1, j);
+        }
+    }
+}
+
+/**
+ * @brief Sorts [first, last) by ascending level, splitting off up to `tasks`
+ *        std::async tasks to sort partitions in parallel.
+ */
+template <typename It>
+void Offline::parallelSort(It first, It last, size_t tasks) {
+    const long MIN_TASK_SIZE = 1 << 15; // smaller ranges aren't worth a thread
+
+    auto byLevel = [](const auto& a, const auto& b) { return a.level_ < b.level_; };
+    if (tasks <= 1 || last - first < 2 * MIN_TASK_SIZE) {
+        std::sort(first, last, byLevel);
+        return;
+    }
+
+    Offline::medianOfThreePivot(first, last);
+    const size_t pivot = first->level_;
+    It split = Offline::blockPartition(first + 1, last, [pivot](const auto& p) { return p.level_ < pivot; }) - 1;
+    std::iter_swap(first, split);
+
+    // hand the left side to a new task, keep the right on this thread
+    auto left = std::async(std::launch::async, [first, split, tasks] { Offline::parallelSort(first, split, tasks / 2); });
+    Offline::parallelSort(split + 1, last, tasks - tasks / 2);
+    left.get();
+}
+
+/**
+ * @brief Sorts a range of PlayerKeys by ascending level with an LSD radix sort.
+ *
+ * One pass counts all six 11-bit digits at once, then each digit that actually varies
+ * across the keys takes one stable scatter pass; levels below 2^33 take at most 3 passes.
+ *
+ * @param first A pointer to the first key
+ * @param last A pointer to one past the last key
+ */
+void Offline::radixSortKeys(PlayerKey* first, PlayerKey* last) {
+    const int BITS = 11; // 2^11 counters per digit still fit in L1
+    const int RADIX = 1 << BITS;
+    const int DIGITS = (8 * sizeof(size_t) + BITS - 1) / BITS;
+    const size_t n = last - first;
+    if (n < 2) {
+        return;
+    }
+
+    auto digit = [](const PlayerKey& key, int d) { return (key.level_ >> (BITS * d)) & (RADIX - 1); };
+
+    std::vector<std::array<size_t, RADIX>> counts(DIGITS);
+    for (auto& count : counts) {
+        count.fill(0);
+    }
+    for (PlayerKey* key = first; key != last; ++key) {
+        for (int d = 0; d < DIGITS; ++d) {
+            counts[d][digit(*key, d)]++;
+        }
+    }
+
+    std::vector<PlayerKey> buffer(n);
+    PlayerKey* from = first;
+    PlayerKey* to = buffer.data();
+
+    for (int d = 0; d < DIGITS; ++d) {
+        // every key shares this digit, so this pass wouldn't move anything
+        if (counts[d][digit(*first, d)] == n) {
+            continue;
+        }
+
+        size_t total = 0;
+        for (size_t& count : counts[d]) { // counts become the starting offset of each digit
+            size_t c = count;
+            count = total;
+            total += c;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            to[counts[d][digit(from[i], d)]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+
+    // an odd number of passes leaves the result in the buffer
+    if (from != first) {
+        std::copy(from, from + n, first);
+    }
+}
+
+/**
+ * @brief Constructs an empty leaderboard.
+ * @param capacity The number of places on the leaderboard, used by cutoff() & top().
+ */
+Leaderboard::Leaderboard(const size_t& capacity) : capacity_(capacity), root_(NONE), random_(std::random_device {}()) {}
+
+/**
+ * @brief The order of the board: a ranks above b if its level is higher,
+ *        or if the levels tie & its id_ is lower.
+ */
+bool Leaderboard::precedes(const Node& a, const Node& b) {
+    if (a.level_ != b.level_) {
+        return a.level_ > b.level_;
+    }
+    return a.id_ < b.id_;
+}
+
+size_t Leaderboard::subtreeSize(int n) const {
+    return n == NONE ? 0 : nodes_[n].size_;
+}
+
+/**
+ * @brief Recomputes the size of a node from its children.
+ */
+void Leaderboard::pull(int n) {
+    nodes_[n].size_ = 1 + subtreeSize(nodes_[n].left_) + subtreeSize(nodes_[n].right_);
+}
+
+/**
+ * @brief Splits a subtree into the nodes ranking above key & the rest.
+ */
+void Leaderboard::split(int t, const Node& key, int& above, int& rest) {
+    if (t == NONE) {
+        above = rest = NONE;
+        return;
+    }
+    if (precedes(nodes_[t], key)) {
+        split(nodes_[t].right_, key, nodes_[t].right_, rest);
+        above = t;
+    } else {
+        split(nodes_[t].left_, key, above, nodes_[t].left_);
+        rest = t;
+    }
+    pull(t);
+}
+
+/**
+ * @brief Joins two subtrees, where every node of `above` ranks above every node of `below`.
+ * @return The root of the joined subtree.
+ */
+int Leaderboard::merge(int above, int below) {
+    if (above == NONE) {
+        return below;
+    }
+    if (below == NONE) {
+        return above;
+    }
+    if (nodes_[above].priority_ > nodes_[below].priority_) {
+        nodes_[above].right_ = merge(nodes_[above].right_, below);
+        pull(above);
+        return above;
+    }
+    nodes_[below].left_ = merge(above, nodes_[below].left_);
+    pull(below);
+    return below;
+}
+
+/**
+ * @brief Inserts a detached node into the tree by its key.
+ */
+void Leaderboard::attach(int n) {
+    nodes_[n].left_ = nodes_[n].right_ = NONE;
+    nodes_[n].size_ = 1;
+
+    int above, rest;
+    split(root_, nodes_[n], above, rest);
+    root_ = merge(merge(above, n), rest);
+}
+
+/**
+ * @brief Removes the node holding key from a subtree, leaving the node itself untouched.
+ * @return The new root of the subtree.
+ */
+int Leaderboard::detach(int t, const Node& key) {
+    Node& node = nodes_[t];
+    if (precedes(key, node)) {
+        node.left_ = detach(node.left_, key);
+    } else if (precedes(node, key)) {
+        node.right_ = detach(node.right_, key);
+    } else {
+        return merge(node.left_, node.right_);
+    }
+    pull(t);
+    return t;
+}
+
+/**
+ * @brief Adds a Player, or replaces the Player with the same id_ (e.g. after a level change).
+ * @param player The Player's new state.
+ * @return true if the Player is new, false if an existing Player was replaced.
+ */
+bool Leaderboard::update(const Player& player) {
+    auto itr = index_.find(player.id_);
+    if (itr != index_.end()) {
+        int n = itr->second;
+        players_[n] = player;
+        if (nodes_[n].level_ != player.level_) { // otherwise it keeps its place
+            root_ = detach(root_, nodes_[n]);
+            nodes_[n].level_ = player.level_;
+            attach(n);
+        }
+        return false;
+    }
+
+    int n;
+    if (!free_.empty()) {
+        n = free_.back();
+        free_.pop_back();
+        players_[n] = player;
+    } else {
+        n = nodes_.size();
+        nodes_.push_back({});
+        players_.push_back(player);
+    }
+    nodes_[n].level_ = player.level_;
+    nodes_[n].id_ = player.id_;
+    nodes_[n].priority_ = random_();
+    index_.emplace(player.id_, n);
+    attach(n);
+    return true;
+}
+
+/**
+ * @brief Removes the Player with a given id_.
+ * @return true if a Player was removed, false if none has that id_.
+ */
+bool Leaderboard::remove(const size_t& id) {
+    auto itr = index_.find(id);
+    if (itr == index_.end()) {
+        return false;
+    }
+    int n = itr->second;
+    root_ = detach(root_, nodes_[n]);
+    players_[n] = Player(); // don't hold on to the name
+    free_.push_back(n);
+    index_.erase(itr);
+    return true;
+}
+
+/**
+ * @brief Checks if a Player with a given id_ is on the board.
+ */
+bool Leaderboard::contains(const size_t& id) const {
+    return index_.count(id) > 0;
+}
+
+/**
+ * @brief Returns the rank of the Player with a given id_, where rank 1 is the highest level.
+ * @throws std::out_of_range If no Player has that id_.
+ */
+size_t Leaderboard::rank(const size_t& id) const {
+    auto itr = index_.find(id);
+    if (itr == index_.end()) {
+        throw std::out_of_range("No player with id " + std::to_string(id));
+    }
+    const Node& key = nodes_[itr->second];
+
+    // count the players ranking above key on the way down to it
+    size_t above = 0;
+    int t = root_;
+    while (t != itr->second) {
+        if (precedes(nodes_[t], key)) {
+            above += subtreeSize(nodes_[t].left_) + 1;
+            t = nodes_[t].right_;
+        } else {
+            t = nodes_[t].left_;
+        }
+    }
+    return above + subtreeSize(nodes_[t].left_) + 1;
+}
+
+/**
+ * @brief Retrieves the Player at a given rank, where rank 1 is the highest level.
+ * @throws std::out_of_range If rank is 0 or greater than size().
+ */
+const Player& Leaderboard::at(const size_t& rank) const {
+    if (rank == 0 || rank > size()) {
+        throw std::out_of_range("No player at rank " + std::to_string(rank));
+    }
+    size_t k = rank - 1; // players still to skip
+    int t = root_;
+    while (true) {
+        size_t left = subtreeSize(nodes_[t].left_);
+        if (k < left) {
+            t = nodes_[t].left_;
+        } else if (k == left) {
+            return players_[t];
+        } else {
+            k -= left + 1;
+            t = nodes_[t].right_;
+        }
+    }
+}
+
+/**
+ * @brief Returns the minimum level required to be on the leaderboard: the level
+ *        of the Player at rank capacity(), or of the last Player if there are fewer.
+ * @return The cutoff level, or 0 if the board is empty.
+ */
+size_t Leaderboard::cutoff() const {
+    if (size() == 0 || capacity_ == 0) {
+        return 0;
+    }
+    return at(std::min(capacity_, size())).level_;
+}
+
+/**
+ * @brief Appends the first `count` Players of a subtree, in rank order.
+ */
+void Leaderboard::collect(int t, size_t& count, std::vector<Player>& out) const {
+    if (t == NONE || count == 0) {
+        return;
+    }
+    collect(nodes_[t].left_, count, out);
+    if (count > 0) {
+        out.push_back(players_[t]);
+        count--;
+        collect(nodes_[t].right_, count, out);
+    }
+}
+
+/**
+ * @brief Retrieves the (up to) capacity() highest ranked Players,
+ *        in ascending order like RankingResult::top_.
+ */
+std::vector<Player> Leaderboard::top() const {
+    std::vector<Player> out;
+    size_t count = std::min(capacity_, size());
+    out.reserve(count);
+    collect(root_, count, out);
+    std::reverse(out.begin(), out.end());
+    return out;
+}
+
+/**
+ * @brief Returns the number of Players on the board, including those below the cutoff.
+ */
+size_t Leaderboard::size() const {
+    return subtreeSize(root_);
+}
+
+/**
+ * @brief Returns the number of places on the leaderboard.
+ */
+size_t Leaderboard::capacity() const {
+    return capacity_;
+}
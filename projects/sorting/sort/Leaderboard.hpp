@@ -1,14 +1,23 @@
 #pragma once
 
 #include "Player.hpp"
+#include "PlayerSnapshot.hpp"
 #include "PlayerStream.hpp"
+#include "QuantileSketch.hpp"
 
 #include <iterator>
 #include <unordered_map>
 #include <vector>
 #include <algorithm> // for heap operations 
+#include <array> // radix sort counts
 #include <chrono> // for timing
 #include <cmath> // floor
+#include <cstdint>
+#include <random> // treap priorities
+#include <set> // windowed ranking
+#include <stdexcept>
+#include <future> // for parallel ranking
+#include <thread> // hardware_concurrency
 
 struct RankingResult {
     /**
@@ -57,6 +66,18 @@ struct RankingResult {
     RankingResult(const std::vector<Player>& top = {}, const std::unordered_map<size_t, size_t>& cutoffs = {}, double elapsed = 0);
 };
 
+/**
+ * @brief A compact stand-in for a Player while ranking: its level & its position in the input.
+ *
+ * At 16 bytes, against ~48 for a Player & its name, a key moves in two words & four
+ * fit in a cache line, so selecting & sorting keys moves a fraction of the memory
+ * that selecting & sorting Players does. Full Players are only gathered at the end.
+ */
+struct PlayerKey {
+    size_t level_;
+    size_t index_; // the Player's index in the vector being ranked
+};
+
 namespace Offline {
 /**
  * @brief Uses a mixture of quickselect/quicksort to
@@ -88,6 +109,73 @@ RankingResult quickSelectRank(std::vector<Player>& players);
  */
 RankingResult heapRank(std::vector<Player>& players);
 
+/**
+ * @brief Uses introselect & a task-parallel quicksort to
+ *        select and sort the top 10% of players in-place
+ *        (excluding the returned RankingResult vector)
+ *
+ * Unlike quickSelectRank(), the selection is O(N) in the worst case: pivots are
+ * medians of 3 until BAD_PARTITION_LIMIT partitions have each kept more than 3/4 of
+ * their range, then medians of medians, which always shrink it by ~30%.
+ * Partitioning is branchless (see blockPartition()), runs of players tied with an earlier
+ * pivot are split off in one pass, & only medianOfMediansPivot() recurses, on a fifth of
+ * the range, so sorted, reversed or duplicate-heavy input can neither go quadratic nor
+ * overflow the stack.
+ *
+ * @param players A reference to the vector of Player objects to be ranked
+ * @param tasks The maximum number of threads sorting the top 10% at once
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players from the input in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of the selection/sorting operation
+ *
+ * @post The order of the parameter vector is modified.
+ */
+RankingResult introSelectRank(std::vector<Player>& players, const size_t& tasks = std::max(1u, std::thread::hardware_concurrency()));
+
+/**
+ * @brief Selects and sorts the top 10% of players by working on PlayerKeys
+ *        rather than on the Players themselves
+ *
+ * Builds one PlayerKey per player, selects the top 10% of keys with introSelect(),
+ * sorts those with radixSortKeys(), & only then copies the selected Players, in order.
+ * The Players are read twice (once for their levels, once to gather the top 10%) & never moved.
+ *
+ * @param players A reference to the vector of Player objects to be ranked
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players from the input in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of building, selecting & sorting the keys & gathering top_
+ *
+ * @note Unlike the other Offline rankers, the parameter vector is left unchanged.
+ */
+RankingResult keyRank(const std::vector<Player>& players);
+
+/**
+ * @brief Selects and sorts the top 10% of the players of a PlayerSnapshot,
+ *        reading their levels straight from the mapped records
+ *
+ * Works like keyRank(): PlayerKeys are built from one sequential pass over the records,
+ * selected & sorted, & only the top 10% are built into full Players from the snapshot.
+ * No other Player (or name) is ever constructed.
+ *
+ * @param snapshot The mapped snapshot whose players are to be ranked
+ * @return A Ranking Result object whose
+ * - top_ vector -> Contains the top 10% of players of the snapshot in sorted order (ascending)
+ * - cutoffs_    -> Is empty
+ * - elapsed_    -> Contains the duration (ms) of building, selecting & sorting the keys & gathering top_
+ */
+RankingResult snapshotRank(const PlayerSnapshot& snapshot);
+
+/**
+ * @brief Moves the `count` highest keys to the front of `keys`, in ascending order.
+ *
+ * The shared core of keyRank() & snapshotRank(): introSelect() then radixSortKeys().
+ *
+ * @pre 0 < count <= keys.size()
+ */
+void selectTopKeys(std::vector<PlayerKey>& keys, const size_t& count);
+
 // HELPER FUNCTIONS 
 
 template <typename T>
@@ -125,11 +213,83 @@ int lomuto_partition(std::vector<T>& array, int low, int high, int pivot);
 template <typename T>
 void quickSelect(std::vector<T>& array, int low, int high, int k);
 
+/**
+ * @brief Partitions a range so that the players satisfying a predicate come first.
+ *
+ * Works on blocks of BLOCK players from both ends: a branch-free pass over each block
+ * records the offsets of the players on the wrong side, then only those are swapped
+ * in pairs. Comparisons never mispredict, & whole Players are only moved when misplaced.
+ *
+ * @param first An iterator to the beginning of the range
+ * @param last An iterator to one past the end of the range
+ * @param goes_left A predicate on a const reference to an element
+ * @return An iterator to the first player not satisfying `goes_left`
+ */
+template <typename It, typename Pred>
+It blockPartition(It first, It last, Pred goes_left);
+
+/**
+ * @brief Moves a pivot for [first, last) to `first`: the median of 3 players
+ *        (or of 3 medians of 3, on larger ranges).
+ */
+template <typename It>
+void medianOfThreePivot(It first, It last);
+
+/**
+ * @brief Moves a pivot for [first, last) to `first`, the median of the medians of groups of 5,
+ *        which guarantees both sides of the partition hold at least ~30% of the range.
+ *
+ * @param bad_partitions The budget left to the calling introSelect(), passed on to the one
+ *      selecting the median of the medians
+ */
+template <typename It>
+void medianOfMediansPivot(It first, It last, int bad_partitions);
+
+// The number of median-of-3 partitions introSelect() lets keep more than 3/4 of their range
+// before it switches to medians of medians; a constant, so the selection stays O(N)
+const int BAD_PARTITION_LIMIT = 4;
+
+/**
+ * @brief Rearranges [first, last) so that `nth` holds the player it would in a sort by
+ *        descending level, all players before it rank at least as high, & all after at most as high.
+ *
+ * @param begin The beginning of the whole array; everything in [begin, first) must rank
+ *      at least as high as every player in [first, last)
+ * @param bad_partitions The number of median-of-3 partitions still allowed to keep more than
+ *      3/4 of their range; at 0, every pivot is a median of medians
+ */
+template <typename It>
+void introSelect(It begin, It first, It nth, It last, int bad_partitions = BAD_PARTITION_LIMIT);
+
+/**
+ * @brief Sorts [first, last) by ascending level, splitting off up to `tasks`
+ *        std::async tasks to sort partitions in parallel.
+ */
+template <typename It>
+void parallelSort(It first, It last, size_t tasks);
+
+/**
+ * @brief Sorts a range of PlayerKeys by ascending level with an LSD radix sort.
+ *
+ * One pass counts all six 11-bit digits at once, then each digit that actually varies
+ * across the keys takes one stable scatter pass; levels below 2^33 take at most 3 passes.
+ *
+ * @param first A pointer to the first key
+ * @param last A pointer to one past the last key
+ */
+void radixSortKeys(PlayerKey* first, PlayerKey* last);
+
 };
 
 namespace Online {
 using PlayerIt = std::vector<Player>::iterator;
 
+// The number of Players rankIncoming reads from its stream per nextBatch() call
+const size_t BATCH_SIZE = 4096;
+
+// rankIncomingParallel only shards an interval if every worker gets at least this many Players
+const size_t MIN_SHARD_SIZE = 16384;
+
 /**
  * @brief Helper function to perculate down the current node in the list.
  * @param root The iterate of the current root node.
@@ -181,6 +341,8 @@ void replaceMin(PlayerIt first, PlayerIt last, Player& target);
  *
  * @note You should use NOT use a priority-queue.
  *       Instead, use a vector, the STL heap operations, & `replaceMin()`
+ * @note The stream is read BATCH_SIZE Players at a time through nextBatch(),
+ *       moving each Player into the heap instead of copying it.
  *
  * @param stream A stream providing Player objects
  * @param reporting_interval The frequency at which to record cutoff levels
@@ -206,6 +368,91 @@ void replaceMin(PlayerIt first, PlayerIt last, Player& target);
  */
 RankingResult rankIncoming(PlayerStream& stream, const size_t& reporting_interval);
 
+/**
+ * @brief Computes the same RankingResult as rankIncoming(), sharding the work across threads.
+ *
+ * The stream is read one reporting interval at a time. Each interval is split into
+ * `workers` contiguous shards, & every worker keeps only the players of its shard at or
+ * above the current cutoff (no other player can make the leaderboard, since the cutoff
+ * never decreases). At the interval's boundary, the survivors are merged with the current
+ * leaderboard using std::nth_element, which gives the new leaderboard & its cutoff.
+ *
+ * Each interval then costs O(reporting_interval / workers) per worker plus an O(reporting_interval)
+ * merge, instead of O(log reporting_interval) per qualifying player.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels
+ * @param workers The number of threads to shard each interval across (including the calling thread)
+ * @return A RankingResult as described in rankIncoming(), with the same top_ levels & cutoffs_.
+ *      Players tied on level at the cutoff may differ.
+ *
+ * @note Falls back to rankIncoming() if workers <= 1, or if an interval is too small to give
+ *       every worker MIN_SHARD_SIZE players; thread start-up would cost more than it saves.
+ * @note If the stream holds fewer than reporting_interval players, the final cutoff is
+ *       the lowest level read.
+ * @post All elements of the stream are read until there are none remaining.
+ */
+RankingResult rankIncomingParallel(PlayerStream& stream, const size_t& reporting_interval, const size_t& workers);
+
+/**
+ * @brief Exhausts a stream of Players like rankIncoming(), but ranks only the `window`
+ *        most recently read players, so the leaderboard & its cutoffs follow recent form.
+ *
+ * The window is a ring of its `window` players, & their (level, arrival) keys are split
+ * between two ordered sets: the <reporting_interval> highest, & the rest. Each new player
+ * expires the oldest one from whichever set holds it, enters one of the sets, & at most one
+ * key moves across to keep the first set full, so every player costs O(log window) & memory
+ * stays O(window) however long the stream is.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels, & the size of the leaderboard
+ * @param window The number of most recent players to rank over
+ * @return A RankingResult in which:
+ * - top_       -> Contains the top <reporting_interval> Players of the last <window> read,
+ *                 in sorted (least to greatest) order
+ * - cutoffs_   -> Maps player count milestones to the minimum level required to be on the
+ *                 leaderboard of the window ending there, including after ALL players have been read
+ * - elapsed_   -> Contains the duration (ms) of the selection/sorting operation
+ *
+ * @note If window < reporting_interval, the leaderboard is the whole window.
+ *       If window covers the whole stream, the result matches rankIncoming().
+ * @throws std::invalid_argument If window is 0; nothing is read from the stream then.
+ * @post All elements of the stream are read until there are none remaining.
+ *
+ * @example With a reporting interval of 2 & a window of 3, reading levels 9, 1, 5, 2, 3:
+ * cutoffs_ = { 2: 1, 4: 2, 5: 3 } (the windows are {9, 1}, {1, 5, 2} & {5, 2, 3})
+ * & top_ holds the players with levels 3 & 5
+ */
+RankingResult rankWindowed(PlayerStream& stream, const size_t& reporting_interval, const size_t& window);
+
+/**
+ * @brief Exhausts a stream of Players into a QuantileSketch of their levels, recording an
+ *        approximate cutoff every <reporting_interval> players instead of an exact one.
+ *
+ * Unlike rankIncoming(), no Players are kept: memory is the sketch's few KB however long the
+ * stream is, & every player costs an amortized O(log k). Since `sketch` is only added to,
+ * one sketch per shard can be filled & merged afterwards, & any other quantile (e.g. p99)
+ * can be read from it once the stream is exhausted.
+ *
+ * @param stream A stream providing Player objects
+ * @param reporting_interval The frequency at which to record cutoff levels
+ * @param sketch The sketch to add every level read to
+ * @param q The quantile to report as the cutoff, e.g. 0.9 for the top 10%
+ * @return A RankingResult in which:
+ * - top_       -> Is empty
+ * - cutoffs_   -> Maps player count milestones to the approximate q-quantile of the levels read
+ *                 by then (within sketch.rankError() of its rank), including after ALL players
+ * - elapsed_   -> Contains the duration (ms) of the sketching
+ *
+ * @post All elements of the stream are read until there are none remaining.
+ *
+ * @example
+ * QuantileSketch sketch;
+ * RankingResult p90 = Online::sketchIncoming(stream, 1000000, sketch, 0.9);
+ * size_t p99 = sketch.quantile(0.99);
+ */
+RankingResult sketchIncoming(PlayerStream& stream, const size_t& reporting_interval, QuantileSketch& sketch, const double& q = 0.9);
+
 // HELPER FUNCTIONS 
 
 /**
@@ -218,4 +465,144 @@ RankingResult rankIncoming(PlayerStream& stream, const size_t& reporting_interva
  */
 void buildHeap(PlayerIt first, PlayerIt last);
 
-};
\ No newline at end of file
+};
+
+/**
+ * @brief A live leaderboard over a changing population of Players, identified by their id_.
+ *
+ * Unlike the rankers above, nothing is recomputed from scratch: level changes & removals
+ * are applied as they happen, & rank or cutoff queries are answered from the current state.
+ *
+ * Players are kept in an order-statistic treap ordered by descending level (ties broken by
+ * ascending id_), in which every node counts its subtree; a hash map finds a Player's node
+ * by id_. Every event & query is O(log n) expected, besides top() which is O(log n + capacity).
+ *
+ * @example
+ * Leaderboard board(2);
+ * board.update(Player("Rykard", 23, 1));
+ * board.update(Player("Malenia", 99, 2));
+ * board.update(Player("Radahn", 50, 3));
+ * board.rank(3) -> 2, board.cutoff() -> 50
+ * board.update(Player("Radahn", 10, 3));
+ * board.rank(3) -> 3, board.cutoff() -> 23
+ */
+class Leaderboard {
+public:
+    /**
+     * @brief Constructs an empty leaderboard.
+     * @param capacity The number of places on the leaderboard, used by cutoff() & top().
+     */
+    explicit Leaderboard(const size_t& capacity);
+
+    /**
+     * @brief Adds a Player, or replaces the Player with the same id_ (e.g. after a level change).
+     * @param player The Player's new state.
+     * @return true if the Player is new, false if an existing Player was replaced.
+     */
+    bool update(const Player& player);
+
+    /**
+     * @brief Removes the Player with a given id_.
+     * @return true if a Player was removed, false if none has that id_.
+     */
+    bool remove(const size_t& id);
+
+    /**
+     * @brief Checks if a Player with a given id_ is on the board.
+     */
+    bool contains(const size_t& id) const;
+
+    /**
+     * @brief Returns the rank of the Player with a given id_, where rank 1 is the highest level.
+     * @throws std::out_of_range If no Player has that id_.
+     */
+    size_t rank(const size_t& id) const;
+
+    /**
+     * @brief Retrieves the Player at a given rank, where rank 1 is the highest level.
+     * @throws std::out_of_range If rank is 0 or greater than size().
+     */
+    const Player& at(const size_t& rank) const;
+
+    /**
+     * @brief Returns the minimum level required to be on the leaderboard: the level
+     *        of the Player at rank capacity(), or of the last Player if there are fewer.
+     * @return The cutoff level, or 0 if the board is empty.
+     */
+    size_t cutoff() const;
+
+    /**
+     * @brief Retrieves the (up to) capacity() highest ranked Players,
+     *        in ascending order like RankingResult::top_.
+     */
+    std::vector<Player> top() const;
+
+    /**
+     * @brief Returns the number of Players on the board, including those below the cutoff.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of places on the leaderboard.
+     */
+    size_t capacity() const;
+
+private:
+    // The tree itself only holds what ordering needs, so that two nodes share a cache line
+    struct Node {
+        size_t level_, id_; // the sort key
+        std::uint32_t priority_; // a random heap priority, which keeps the treap balanced
+        int left_, right_; // indices into nodes_, or NONE
+        std::uint32_t size_; // the number of nodes in the subtree rooted here
+    };
+
+    static const int NONE = -1;
+
+    size_t capacity_;
+    int root_;
+    std::vector<Node> nodes_; // every node, in an array so they stay compact
+    std::vector<Player> players_; // the Player of every node, at the same index
+    std::vector<int> free_; // indices of removed nodes, reused first
+    std::unordered_map<size_t, int> index_; // id_ -> node
+    std::mt19937 random_;
+
+    /**
+     * @brief The order of the board: a ranks above b if its level is higher,
+     *        or if the levels tie & its id_ is lower.
+     */
+    static bool precedes(const Node& a, const Node& b);
+
+    size_t subtreeSize(int n) const;
+
+    /**
+     * @brief Recomputes the size of a node from its children.
+     */
+    void pull(int n);
+
+    /**
+     * @brief Splits a subtree into the nodes ranking above key & the rest.
+     */
+    void split(int t, const Node& key, int& above, int& rest);
+
+    /**
+     * @brief Joins two subtrees, where every node of `above` ranks above every node of `below`.
+     * @return The root of the joined subtree.
+     */
+    int merge(int above, int below);
+
+    /**
+     * @brief Inserts a detached node into the tree by its key.
+     */
+    void attach(int n);
+
+    /**
+     * @brief Removes the node holding key from a subtree, leaving the node itself untouched.
+     * @return The new root of the subtree.
+     */
+    int detach(int t, const Node& key);
+
+    /**
+     * @brief Appends the first `count` Players of a subtree, in rank order.
+     */
+    void collect(int t, size_t& count, std::vector<Player>& out) const;
+};
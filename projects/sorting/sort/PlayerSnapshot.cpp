@@ -0,0 +1,187 @@
+#include "PlayerSnapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+const char MAGIC[8] = { 'P', 'L', 'Y', 'R', 'S', 'N', 'P', '1' };
+}
+
+/**
+ * @brief Writes Players to a binary snapshot file, to be read back by PlayerSnapshot.
+ *
+ * @param path The file to create or overwrite.
+ * @param players The Players to write.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void writeSnapshot(const std::string& path, const std::vector<Player>& players) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+
+    std::vector<PlayerRecord> records;
+    std::vector<std::uint64_t> offsets;
+    records.reserve(players.size());
+    offsets.reserve(players.size() + 1);
+
+    std::uint64_t names_size = 0;
+    for (const Player& player : players) {
+        records.push_back({ player.level_, player.id_ });
+        offsets.push_back(names_size);
+        names_size += player.name_.size();
+    }
+    offsets.push_back(names_size);
+
+    PlayerSnapshot::Header header;
+    std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+    header.count_ = players.size();
+    header.names_size_ = names_size;
+    header.reserved_ = 0;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(PlayerRecord));
+    file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint64_t));
+    for (const Player& player : players) {
+        file.write(player.name_.data(), player.name_.size());
+    }
+    if (!file.flush()) {
+        throw std::runtime_error("Failed writing " + path);
+    }
+}
+
+/**
+ * @brief Maps a snapshot file into memory.
+ * @param path The file written by writeSnapshot().
+ * @throws std::runtime_error If the file cannot be opened or mapped, or isn't a whole snapshot:
+ *      its length must match its header, & its name offsets must start at 0, never decrease,
+ *      & end at the size of the name blob.
+ */
+PlayerSnapshot::PlayerSnapshot(const std::string& path) : data_(nullptr), length_(0), size_(0) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw std::runtime_error(path + " is not a player snapshot");
+    }
+    length_ = status.st_size;
+    data_ = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file open
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        throw std::runtime_error("Cannot map " + path);
+    }
+
+    const Header* header = static_cast<const Header*>(data_);
+    size_ = header->count_;
+    // size_ is bounded first, so the fixed-width part can't overflow; the name blob must fill the rest
+    bool valid = std::memcmp(header->magic_, MAGIC, sizeof(MAGIC)) == 0 && size_ < length_ / sizeof(PlayerRecord);
+    size_t fixed = valid ? sizeof(Header) + size_ * sizeof(PlayerRecord) + (size_ + 1) * sizeof(std::uint64_t) : 0;
+    if (!valid || fixed > length_ || header->names_size_ != length_ - fixed) {
+        ::munmap(data_, length_);
+        throw std::runtime_error(path + " is not a player snapshot");
+    }
+
+    const char* base = static_cast<const char*>(data_);
+    records_ = reinterpret_cast<const PlayerRecord*>(base + sizeof(Header));
+    name_offsets_ = reinterpret_cast<const std::uint64_t*>(records_ + size_);
+    names_ = reinterpret_cast<const char*>(name_offsets_ + size_ + 1);
+
+    // Every name must lie within the blob, so name() & player() never read past the mapping
+    bool ordered = name_offsets_[0] == 0 && name_offsets_[size_] == header->names_size_;
+    for (size_t i = 0; ordered && i < size_; i++) {
+        ordered = name_offsets_[i] <= name_offsets_[i + 1];
+    }
+    if (!ordered) {
+        ::munmap(data_, length_);
+        throw std::runtime_error(path + " has corrupt name offsets");
+    }
+}
+
+/**
+ * @brief Unmaps the file.
+ */
+PlayerSnapshot::~PlayerSnapshot() {
+    if (data_ != nullptr) {
+        ::munmap(data_, length_);
+    }
+}
+
+/**
+ * @brief Returns the number of players in the snapshot.
+ */
+size_t PlayerSnapshot::size() const {
+    return size_;
+}
+
+/**
+ * @brief Returns the mapped records, an array of size() PlayerRecords.
+ */
+const PlayerRecord* PlayerSnapshot::records() const {
+    return records_;
+}
+
+/**
+ * @brief Copies the name of the player at a given index out of the name blob.
+ */
+std::string PlayerSnapshot::name(const size_t& index) const {
+    return std::string(names_ + name_offsets_[index], name_offsets_[index + 1] - name_offsets_[index]);
+}
+
+/**
+ * @brief Builds the full Player at a given index.
+ */
+Player PlayerSnapshot::player(const size_t& index) const {
+    return Player(name(index), records_[index].level_, records_[index].id_);
+}
+
+/**
+ * @brief Constructs a stream over every player of a snapshot.
+ * @param snapshot The snapshot to read.
+ */
+MappedPlayerStream::MappedPlayerStream(const PlayerSnapshot& snapshot) : snapshot_(snapshot), current_(0) {}
+
+/**
+* @brief Retrieves the next Player in the stream.
+*
+* @return The next Player object in the sequence.
+* @throws std::runtime_error If there are no more players remaining in the stream.
+*/
+Player MappedPlayerStream::nextPlayer() {
+    if (remaining() > 0) {
+        return snapshot_.player(current_++);
+    }
+    throw std::runtime_error("No more players left.");
+}
+
+/**
+ * @brief Retrieves up to `count` of the next Players in the stream at once.
+ *
+ * @param out The vector to fill. It is cleared first, keeping its capacity.
+ * @param count The maximum number of Players to read.
+ * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+ */
+size_t MappedPlayerStream::nextBatch(std::vector<Player>& out, const size_t& count) {
+    out.clear();
+    size_t last = current_ + std::min(count, remaining());
+    for (; current_ < last; ++current_) {
+        out.push_back(snapshot_.player(current_));
+    }
+    return out.size();
+}
+
+/**
+ * @brief Returns the number of players remaining in the stream.
+ *
+ * @return The count of players left to be read.
+ */
+size_t MappedPlayerStream::remaining() const {
+    return snapshot_.size() - current_;
+}
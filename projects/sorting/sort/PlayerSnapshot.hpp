@@ -0,0 +1,147 @@
+#pragma once
+#include "Player.hpp"
+#include "PlayerStream.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The fixed-width part of a Player in a snapshot file.
+ */
+struct PlayerRecord {
+    std::uint64_t level_;
+    std::uint64_t id_;
+};
+
+/**
+ * @brief Writes Players to a binary snapshot file, to be read back by PlayerSnapshot.
+ *
+ * The file holds, in native byte order:
+ * 1) A 32 byte header: the magic "PLYRSNP1", the number of players N & the size of the name blob
+ * 2) N PlayerRecords, in the order of `players`
+ * 3) N + 1 offsets into the name blob, where player i's name is [offset i, offset i + 1)
+ * 4) The name blob: every name, back to back
+ *
+ * @param path The file to create or overwrite.
+ * @param players The Players to write.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void writeSnapshot(const std::string& path, const std::vector<Player>& players);
+
+/**
+ * @brief A read-only, memory-mapped view of a file written by writeSnapshot().
+ *
+ * Opening a snapshot maps the file & checks its header & name offsets (8 bytes per player);
+ * records & names are paged in from disk as they are read.
+ * The records can be ranked where they are (see Offline::snapshotRank()), & only the
+ * Players actually returned are built, names & all.
+ *
+ * @example
+ * writeSnapshot("players.snap", players);
+ * PlayerSnapshot snapshot("players.snap");
+ * snapshot.size() -> players.size()
+ * snapshot.records()[0].level_ -> players[0].level_
+ * snapshot.player(0) -> players[0]
+ */
+class PlayerSnapshot {
+public:
+    /**
+     * @brief Maps a snapshot file into memory.
+     * @param path The file written by writeSnapshot().
+     * @throws std::runtime_error If the file cannot be opened or mapped, or isn't a whole snapshot:
+     *      its length must match its header, & its name offsets must start at 0, never decrease,
+     *      & end at the size of the name blob.
+     */
+    explicit PlayerSnapshot(const std::string& path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~PlayerSnapshot();
+
+    PlayerSnapshot(const PlayerSnapshot&) = delete;
+    PlayerSnapshot& operator=(const PlayerSnapshot&) = delete;
+
+    /**
+     * @brief Returns the number of players in the snapshot.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the mapped records, an array of size() PlayerRecords.
+     */
+    const PlayerRecord* records() const;
+
+    /**
+     * @brief Copies the name of the player at a given index out of the name blob.
+     */
+    std::string name(const size_t& index) const;
+
+    /**
+     * @brief Builds the full Player at a given index.
+     */
+    Player player(const size_t& index) const;
+
+private:
+    struct Header {
+        char magic_[8];
+        std::uint64_t count_;
+        std::uint64_t names_size_;
+        std::uint64_t reserved_;
+    };
+
+    void* data_; // the mapping
+    size_t length_;
+    size_t size_;
+    const PlayerRecord* records_;
+    const std::uint64_t* name_offsets_;
+    const char* names_;
+
+    friend void writeSnapshot(const std::string& path, const std::vector<Player>& players);
+};
+
+/**
+ * @brief A PlayerStream over a PlayerSnapshot, reading its players in order.
+ *
+ * Nothing is parsed: every Player is built straight from its mapped record & name,
+ * so reading a stream costs one sequential pass over the file.
+ *
+ * @note The snapshot must outlive the stream. Several streams may read one snapshot.
+ */
+class MappedPlayerStream : public PlayerStream {
+private:
+    const PlayerSnapshot& snapshot_;
+    size_t current_; // index of the next player
+
+public:
+    /**
+     * @brief Constructs a stream over every player of a snapshot.
+     * @param snapshot The snapshot to read.
+     */
+    explicit MappedPlayerStream(const PlayerSnapshot& snapshot);
+
+    /**
+    * @brief Retrieves the next Player in the stream.
+    *
+    * @return The next Player object in the sequence.
+    * @throws std::runtime_error If there are no more players remaining in the stream.
+    */
+    Player nextPlayer() override;
+
+    /**
+     * @brief Retrieves up to `count` of the next Players in the stream at once.
+     *
+     * @param out The vector to fill. It is cleared first, keeping its capacity.
+     * @param count The maximum number of Players to read.
+     * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+     */
+    size_t nextBatch(std::vector<Player>& out, const size_t& count) override;
+
+    /**
+     * @brief Returns the number of players remaining in the stream.
+     *
+     * @return The count of players left to be read.
+     */
+    size_t remaining() const override;
+};
@@ -1,4 +1,26 @@
 #include "PlayerStream.hpp"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+/**
+ * @brief Retrieves up to `count` of the next Players in the stream at once.
+ *
+ * The default implementation calls nextPlayer() until `count` Players are read or
+ * the stream runs out; streams that can hand out Players in bulk should override it.
+ *
+ * @param out The vector to fill. It is cleared first, keeping its capacity so one
+ *      buffer can be reused across calls.
+ * @param count The maximum number of Players to read.
+ * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+ */
+size_t PlayerStream::nextBatch(std::vector<Player>& out, const size_t& count) {
+    out.clear();
+    while (out.size() < count && remaining() > 0) {
+        out.push_back(nextPlayer());
+    }
+    return out.size();
+}
 
 /**
 * @brief The interface for a PlayerStream created using the contents of a vector.
@@ -27,6 +49,7 @@
  * @param players The vector of Player objects to stream.
  */
 VectorPlayerStream::VectorPlayerStream(const std::vector<Player>& players) : players_(players), current_(0) {}
+VectorPlayerStream::VectorPlayerStream(std::vector<Player>&& players) : players_(std::move(players)), current_(0) {}
 
 /**
 * @brief Retrieves the next Player in the stream.
@@ -40,13 +63,32 @@ VectorPlayerStream::VectorPlayerStream(const std::vector<Player>& players) : pla
 Player VectorPlayerStream::nextPlayer() {
     if (remaining() > 0) {
         current_++;
-        return players_[current_-1];
+        return std::move(players_[current_-1]); // never read again
     }
 
     // if not more players left
     throw std::runtime_error("No more players left.");
 }
 
+/**
+ * @brief Retrieves up to `count` of the next Players in the stream at once.
+ *
+ * Each Player is only ever read once, so they are moved out of the stream
+ * rather than copied.
+ *
+ * @param out The vector to fill. It is cleared first, keeping its capacity.
+ * @param count The maximum number of Players to read.
+ * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+ */
+size_t VectorPlayerStream::nextBatch(std::vector<Player>& out, const size_t& count) {
+    size_t taken = std::min(count, remaining());
+    auto first = players_.begin() + current_;
+
+    out.assign(std::make_move_iterator(first), std::make_move_iterator(first + taken));
+    current_ += taken;
+    return taken;
+}
+
 /**
 * @brief Returns the number of players remaining in the stream.
 *
@@ -54,4 +96,171 @@ Player VectorPlayerStream::nextPlayer() {
 */
 size_t VectorPlayerStream::remaining() const {
     return players_.size() - current_;
-}
\ No newline at end of file
+}
+
+#ifdef API_ENABLED
+using json = nlohmann::json;
+
+/**
+ * @brief Constructs an APIPlayerStream that fetches Players from an API and presents the contents as a stream
+ *
+ * @param expected_length The total number of Player objects expected from the API.
+ * @param seed A seed value used for API requests to ensure consistent results
+ * @param batch_size The number of Player objects to fetch in each API request.
+ *
+ * @post The fetching thread is started, with the first IN_FLIGHT requests issued right away.
+ */
+APIPlayerStream::APIPlayerStream(const size_t& expected_length, const size_t& seed, const size_t& batch_size)
+    : cursor_(1), seed_(seed), expected_length_(expected_length), batch_size_(std::max<size_t>(batch_size, 1)), read_(0),
+      buffer_(2 * IN_FLIGHT * std::max<size_t>(batch_size, 1)), stop_(false), failed_(false) {
+    fetcher_ = std::thread(&APIPlayerStream::fetchLoop, this);
+}
+
+/**
+ * @brief Stops & joins the fetching thread, abandoning any requests still in flight.
+ */
+APIPlayerStream::~APIPlayerStream() {
+    stop_.store(true, std::memory_order_relaxed);
+    if (fetcher_.joinable()) {
+        fetcher_.join();
+    }
+}
+
+/**
+ * @brief Issues an asynchronous request for the batch starting at a cursor.
+ * @param cursor The cursor query parameter.
+ */
+cpr::AsyncResponse APIPlayerStream::request(const size_t& cursor) const {
+    return cpr::GetAsync(cpr::Url { SOCKET + "/api" },
+        cpr::Parameters { { "seed", std::to_string(seed_) },
+            { "cursor", std::to_string(cursor) },
+            { "batch", std::to_string(batch_size_) } });
+}
+
+/**
+ * @brief Body of the fetching thread: keeps IN_FLIGHT requests outstanding & pushes
+ * every fetched player into `buffer_` until `expected_length_` players are fetched.
+ * @post On failure, stores the exception in `error_` & sets `failed_`.
+ */
+void APIPlayerStream::fetchLoop() {
+    try {
+        // each outstanding request, with the cursor it was issued at
+        std::deque<std::pair<size_t, cpr::AsyncResponse>> in_flight;
+        size_t next_cursor = cursor_;
+        size_t requested = 0; // players covered by the requests issued so far
+        size_t fetched = 0;
+
+        while (fetched < expected_length_ && !stop_.load(std::memory_order_relaxed)) {
+            while (in_flight.size() < IN_FLIGHT && requested < expected_length_) {
+                in_flight.emplace_back(next_cursor, request(next_cursor));
+                next_cursor += batch_size_;
+                requested += batch_size_;
+            }
+
+            cpr::Response response = in_flight.front().second.get();
+            in_flight.pop_front();
+            if (response.status_code != 200) {
+                throw std::runtime_error("API request failed with status " + std::to_string(response.status_code));
+            }
+
+            json body = json::parse(response.text);
+            const json& levels = body["levels"];
+            if (levels.empty()) {
+                throw std::runtime_error("API ran out of players before the expected length.");
+            }
+            for (const json& level : levels) {
+                if (fetched == expected_length_) {
+                    break;
+                }
+                Player player("API_" + std::to_string(fetched), level.template get<size_t>());
+                while (!buffer_.tryPush(std::move(player))) { // the consumer is behind
+                    if (stop_.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    std::this_thread::yield();
+                }
+                fetched++;
+            }
+
+            // the outstanding requests guessed their cursors; restart them if the API disagrees
+            cursor_ = body["cursor"].template get<size_t>();
+            if (in_flight.empty() || in_flight.front().first != cursor_) {
+                in_flight.clear();
+                next_cursor = cursor_;
+                requested = fetched;
+            }
+        }
+    } catch (...) {
+        error_ = std::current_exception();
+        failed_.store(true, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Pops the next fetched player, waiting for the fetching thread if none is buffered yet.
+ * @param player Set to the popped player.
+ * @throws std::runtime_error (or whatever the fetching thread threw) if fetching failed.
+ */
+void APIPlayerStream::pop(Player& player) {
+    while (!buffer_.tryPop(player)) {
+        if (failed_.load(std::memory_order_acquire)) {
+            // players pushed before the failure are still good
+            if (buffer_.tryPop(player)) {
+                break;
+            }
+            std::rethrow_exception(error_);
+        }
+        std::this_thread::yield();
+    }
+    read_++;
+}
+
+/**
+* @brief Retrieves the next Player in the stream.
+*
+* @details Pops the next Player fetched by the background thread, waiting for it
+* only if the requests for it haven't completed yet.
+*
+* @return The next Player object in the sequence.
+* @throws std::runtime_error If there are no more players remaining or if the API request fails.
+*/
+Player APIPlayerStream::nextPlayer() {
+    if (remaining() == 0) {
+        throw std::runtime_error("No more players left.");
+    }
+    Player player;
+    pop(player);
+    return player;
+}
+
+/**
+ * @brief Retrieves up to `count` of the next Players in the stream at once,
+ * popping them off the ring without a virtual call per Player.
+ *
+ * @param out The vector to fill. It is cleared first, keeping its capacity.
+ * @param count The maximum number of Players to read.
+ * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+ * @throws std::runtime_error If the API request fails; `out` then holds only the Players read before it.
+ */
+size_t APIPlayerStream::nextBatch(std::vector<Player>& out, const size_t& count) {
+    out.clear();
+    size_t taken = std::min(count, remaining());
+    Player player;
+    while (out.size() < taken) {
+        pop(player);
+        out.push_back(std::move(player));
+    }
+    return out.size();
+}
+
+/**
+ * @brief Returns the number of players remaining in the stream.
+ *
+ * @return The count of players left to be read.
+ * @example If our stream is initialized with expected length 5,
+ *   after calling nextPlayer() twice, we'll have 3 players remaining.
+ */
+size_t APIPlayerStream::remaining() const {
+    return expected_length_ - read_;
+}
+#endif
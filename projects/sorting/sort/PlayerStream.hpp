@@ -29,12 +29,27 @@ public:
 
     virtual Player nextPlayer() = 0;
 
+    /**
+     * @brief Retrieves up to `count` of the next Players in the stream at once.
+     *
+     * The default implementation calls nextPlayer() until `count` Players are read or
+     * the stream runs out; streams that can hand out Players in bulk should override it.
+     *
+     * @param out The vector to fill. It is cleared first, keeping its capacity so one
+     *      buffer can be reused across calls.
+     * @param count The maximum number of Players to read.
+     * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+     */
+    virtual size_t nextBatch(std::vector<Player>& out, const size_t& count);
+
     /**
      * @brief Returns the number of players remaining in the stream.
 
      * @return The count of players left to be read.
      */
     virtual size_t remaining() const = 0;
+
+    virtual ~PlayerStream() = default;
 };
 
 /**
@@ -69,6 +84,7 @@ public:
      * @param players The vector of Player objects to stream.
      */
     VectorPlayerStream(const std::vector<Player>& players);
+    VectorPlayerStream(std::vector<Player>&& players);
 
     /**
     * @brief Retrieves the next Player in the stream.
@@ -81,6 +97,18 @@ public:
     */
     Player nextPlayer() override;
 
+    /**
+     * @brief Retrieves up to `count` of the next Players in the stream at once.
+     *
+     * Each Player is only ever read once, so they are moved out of the stream
+     * rather than copied.
+     *
+     * @param out The vector to fill. It is cleared first, keeping its capacity.
+     * @param count The maximum number of Players to read.
+     * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+     */
+    size_t nextBatch(std::vector<Player>& out, const size_t& count) override;
+
     /**
      * @brief Returns the number of players remaining in the stream.
      *
@@ -91,8 +119,13 @@ public:
 
 // For extra credit
 #ifdef API_ENABLED
+#include "SpscRing.hpp"
+#include <atomic>
 #include <cpr/cpr.h>
+#include <deque>
+#include <exception>
 #include <nlohmann/json.hpp>
+#include <thread>
 
 /**
  * @brief A PlayerStream implementation that fetches Player objects from an API in batches.
@@ -130,11 +163,18 @@ public:
  * format of the server of what you'll be calling.
  *
  * The numbers will be different though, so don't even think of hard-coding it :)
+ *
+ * Fetching is pipelined on a background thread, which keeps IN_FLIGHT batch requests
+ * outstanding (cpr::GetAsync) & pushes the players it receives into a lock-free
+ * single-producer/single-consumer ring. nextPlayer() & nextBatch() only pop from the ring,
+ * so network latency overlaps with whatever the consumer does between calls.
+ * Requests after the first assume the cursor advances by batch_size; if a response
+ * says otherwise, the speculative requests are dropped & fetching resumes from its cursor.
  */
 class APIPlayerStream : public PlayerStream {
 protected:
     const std::string PORT = "5000";
-    const std::string HOSTNAME = 'http://127.0.0.1';
+    const std::string HOSTNAME = "http://127.0.0.1";
     const std::string SOCKET = HOSTNAME + ":" + PORT;
 
 private:
@@ -149,9 +189,40 @@ private:
      * we'll use seeds to pseudo-randomly generate contents.
      * Make sure to include this in your calls.
      */
-    size_t cursor_, seed_;
+    size_t cursor_, seed_; // cursor_ is only touched by the fetching thread
+
+    // The number of batch requests the fetching thread keeps outstanding
+    static const size_t IN_FLIGHT = 4;
+
+    size_t expected_length_, batch_size_;
+    size_t read_; // players handed out so far
+
+    SpscRing<Player> buffer_; // players fetched but not yet read
+    std::atomic<bool> stop_; // set by the destructor to end the fetching thread early
+    std::atomic<bool> failed_; // set by the fetching thread once error_ holds why it stopped
+    std::exception_ptr error_;
+    std::thread fetcher_;
+
+    /**
+     * @brief Body of the fetching thread: keeps IN_FLIGHT requests outstanding & pushes
+     * every fetched player into `buffer_` until `expected_length_` players are fetched.
+     * @post On failure, stores the exception in `error_` & sets `failed_`.
+     */
+    void fetchLoop();
+
+    /**
+     * @brief Issues an asynchronous request for the batch starting at a cursor.
+     * @param cursor The cursor query parameter.
+     */
+    cpr::AsyncResponse request(const size_t& cursor) const;
+
+    /**
+     * @brief Pops the next fetched player, waiting for the fetching thread if none is buffered yet.
+     * @param player Set to the popped player.
+     * @throws std::runtime_error (or whatever the fetching thread threw) if fetching failed.
+     */
+    void pop(Player& player);
 
-    // Your additional private members here
 public:
     /**
      * @brief Constructs an APIPlayerStream that fetches Players from an API and presents the contents as a stream
@@ -170,16 +241,19 @@ public:
      */
     APIPlayerStream(const size_t& expected_length, const size_t& seed, const size_t& batch_size = 5);
 
+    /**
+     * @brief Stops & joins the fetching thread, abandoning any requests still in flight.
+     */
+    ~APIPlayerStream();
+
+    APIPlayerStream(const APIPlayerStream&) = delete;
+    APIPlayerStream& operator=(const APIPlayerStream&) = delete;
+
     /**
     * @brief Retrieves the next Player in the stream.
     *
-    * @details Performs either of the following:
-    * If the currently stored batched has players that have not been read yet,
-    * returns the next Player object from the current batch.
-    *
-    * OR
-    *
-    * If the current batch has been exhausted,
+    * @details Pops the next Player fetched by the background thread, waiting for it
+    * only if the requests for it haven't completed yet. For every batch, the background thread:
     *   1) Issues a new API request
     *       using 'seed_' for the seed query parameter
     *       the current `cursor_` value for the cursor query parameter
@@ -189,7 +263,7 @@ public:
     *       the API will ONLY return a number representing the level of a player.
     *       When recording the contents, you can name Player objects whatever you like.
     *
-    *   3) Returns the first Player Object in the newly retrieved batch.
+    *   3) Pushes the batch's Player Objects onto the ring, in order.
 
     * @post If a new API call is made, `cursor_` is
     *   set to the updated cursor value returned by the API call.
@@ -200,6 +274,17 @@ public:
     */
     Player nextPlayer() override;
 
+    /**
+     * @brief Retrieves up to `count` of the next Players in the stream at once,
+     * popping them off the ring without a virtual call per Player.
+     *
+     * @param out The vector to fill. It is cleared first, keeping its capacity.
+     * @param count The maximum number of Players to read.
+     * @return The number of Players read into `out`, which is 0 only once the stream is exhausted.
+     * @throws std::runtime_error If the API request fails; `out` then holds only the Players read before it.
+     */
+    size_t nextBatch(std::vector<Player>& out, const size_t& count) override;
+
     /**
      * @brief Returns the number of players remaining in the stream.
      *
@@ -0,0 +1,172 @@
+#include "QuantileSketch.hpp"
+
+const size_t QuantileSketch::DEFAULT_K;
+const size_t QuantileSketch::MIN_CAPACITY;
+
+/**
+ * @brief Constructs an empty sketch.
+ * @param k The accuracy parameter; the rank error shrinks roughly as 1 / k,
+ *      & the memory used grows as about 3k levels.
+ * @throws std::invalid_argument If k < MIN_CAPACITY.
+ */
+QuantileSketch::QuantileSketch(const size_t& k) : k_(k), count_(0), retained_(0), capacity_(0), random_(1) {
+    if (k < MIN_CAPACITY) {
+        throw std::invalid_argument("QuantileSketch k must be at least " + std::to_string(MIN_CAPACITY));
+    }
+    grow();
+}
+
+/**
+ * @brief Returns the capacity of compactor h, given the current number of compactors.
+ */
+size_t QuantileSketch::capacity(const size_t& h) const {
+    size_t depth = compactors_.size() - 1 - h; // how far below the top compactor h is
+    size_t width = std::ceil(k_ * std::pow(2.0 / 3.0, depth));
+    return std::max(width, MIN_CAPACITY);
+}
+
+/**
+ * @brief Adds a compactor on top & recomputes capacity_.
+ */
+void QuantileSketch::grow() {
+    compactors_.emplace_back();
+    capacity_ = 0;
+    for (size_t h = 0; h < compactors_.size(); ++h) {
+        capacity_ += capacity(h);
+    }
+}
+
+/**
+ * @brief Promotes every other level of compactor h to compactor h + 1.
+ */
+void QuantileSketch::compact(const size_t& h) {
+    if (h + 1 == compactors_.size()) {
+        grow();
+    }
+    std::vector<size_t>& from = compactors_[h];
+    std::vector<size_t>& to = compactors_[h + 1];
+    std::sort(from.begin(), from.end());
+
+    // an odd level out stays behind, so the weight of the sketch is unchanged
+    size_t even = from.size() & ~size_t(1);
+    for (size_t i = random_() & 1; i < even; i += 2) {
+        to.push_back(from[i]);
+    }
+    retained_ -= even / 2;
+    if (even < from.size()) {
+        from[0] = from.back();
+        from.resize(1);
+    } else {
+        from.clear();
+    }
+}
+
+/**
+ * @brief Compacts compactors until the retained levels fit in capacity_.
+ */
+void QuantileSketch::compress() {
+    while (retained_ >= capacity_) {
+        // some compactor must be at capacity here, since they sum to capacity_
+        size_t h = 0;
+        while (compactors_[h].size() < capacity(h)) {
+            h++;
+        }
+        compact(h);
+    }
+}
+
+/**
+ * @brief Adds a level to the sketch. Amortized O(log k).
+ */
+void QuantileSketch::update(const size_t& level) {
+    compactors_[0].push_back(level);
+    count_++;
+    retained_++;
+    if (retained_ >= capacity_) {
+        compress();
+    }
+}
+
+/**
+ * @brief Adds every level another sketch has seen to this one.
+ * @param other A sketch, possibly of another shard of the same stream.
+ * @throws std::invalid_argument If other was constructed with a different k.
+ */
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.k_ != k_) {
+        throw std::invalid_argument("Cannot merge QuantileSketches of different k");
+    }
+    while (compactors_.size() < other.compactors_.size()) {
+        grow();
+    }
+    for (size_t h = 0; h < other.compactors_.size(); ++h) {
+        compactors_[h].insert(compactors_[h].end(), other.compactors_[h].begin(), other.compactors_[h].end());
+    }
+    count_ += other.count_;
+    retained_ += other.retained_;
+    compress();
+}
+
+/**
+ * @brief Estimates the q-quantile of the levels seen: the smallest level
+ *        that at least a q fraction of them are at or below.
+ *
+ * Gathers the retained levels with their weights, sorts them, & walks their running weight.
+ *
+ * @param q The fraction, from 0 (the lowest level) to 1 (the highest level).
+ * @return A level whose rank is within rankError() * count() of q * count(),
+ *      with 99% confidence.
+ * @throws std::out_of_range If the sketch is empty or q is outside [0, 1].
+ */
+size_t QuantileSketch::quantile(const double& q) const {
+    if (count_ == 0) {
+        throw std::out_of_range("Cannot take a quantile of an empty QuantileSketch");
+    }
+    if (!(q >= 0 && q <= 1)) {
+        throw std::out_of_range("Quantile " + std::to_string(q) + " is outside [0, 1]");
+    }
+
+    std::vector<std::pair<size_t, size_t>> weighted; // (level, weight)
+    weighted.reserve(retained_);
+    for (size_t h = 0; h < compactors_.size(); ++h) {
+        for (const size_t& level : compactors_[h]) {
+            weighted.push_back({level, size_t(1) << h});
+        }
+    }
+    std::sort(weighted.begin(), weighted.end());
+
+    double target = q * count_;
+    size_t seen = 0;
+    for (const auto& entry : weighted) {
+        seen += entry.second;
+        if (seen >= target) {
+            return entry.first;
+        }
+    }
+    return weighted.back().first;
+}
+
+/**
+ * @brief Returns the rank error bound of quantile(), as a fraction of count().
+ *
+ * Uses the empirical bound for KLL sketches at 99% confidence, 2.296 / k^0.9723
+ * (from Apache DataSketches), e.g. ~1.3% for the default k.
+ */
+double QuantileSketch::rankError() const {
+    return 2.296 / std::pow(k_, 0.9723);
+}
+
+/**
+ * @brief Returns the number of levels the sketch has seen.
+ */
+size_t QuantileSketch::count() const {
+    return count_;
+}
+
+/**
+ * @brief Returns the number of levels the sketch currently keeps,
+ *        each taking sizeof(size_t) bytes.
+ */
+size_t QuantileSketch::retained() const {
+    return retained_;
+}
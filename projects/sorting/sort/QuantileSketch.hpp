@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath> // pow, ceil
+#include <random> // compaction coin flips
+#include <stdexcept>
+#include <string> // to_string
+#include <utility>
+#include <vector>
+
+/**
+ * @brief An approximate quantile summary of a stream of levels (a KLL sketch),
+ *        in a few KB of memory however many levels it has seen.
+ *
+ * Levels are kept in a stack of compactors, where a level in compactor h stands for 2^h
+ * of the levels seen. When the sketch is full, the lowest compactor over its capacity is
+ * sorted & every other level of it (starting at a random one of the first two) is promoted
+ * to the compactor above, halving its count but keeping the rank of any level about right.
+ * Capacities shrink by 2/3 per compactor going down from the top one (& never below
+ * MIN_CAPACITY), so with the default k the sketch retains well under a thousand levels.
+ *
+ * Sketches of the same k can be merged (e.g. one per shard), & answer as if they had seen
+ * both streams.
+ *
+ * @example
+ * QuantileSketch sketch;
+ * for (size_t level = 1; level <= 1000000; ++level) sketch.update(level);
+ * sketch.quantile(0.9) -> 900000, give or take rankError() * 1000000 ranks (~1.3%)
+ */
+class QuantileSketch {
+public:
+    // The default accuracy parameter: the capacity of the top compactor
+    static const size_t DEFAULT_K = 200;
+
+    // The smallest capacity of any compactor
+    static const size_t MIN_CAPACITY = 8;
+
+    /**
+     * @brief Constructs an empty sketch.
+     * @param k The accuracy parameter; the rank error shrinks roughly as 1 / k,
+     *      & the memory used grows as about 3k levels.
+     * @throws std::invalid_argument If k < MIN_CAPACITY.
+     */
+    explicit QuantileSketch(const size_t& k = DEFAULT_K);
+
+    /**
+     * @brief Adds a level to the sketch. Amortized O(log k).
+     */
+    void update(const size_t& level);
+
+    /**
+     * @brief Adds every level another sketch has seen to this one.
+     * @param other A sketch, possibly of another shard of the same stream.
+     * @throws std::invalid_argument If other was constructed with a different k.
+     */
+    void merge(const QuantileSketch& other);
+
+    /**
+     * @brief Estimates the q-quantile of the levels seen: the smallest level
+     *        that at least a q fraction of them are at or below.
+     *
+     * @param q The fraction, from 0 (the lowest level) to 1 (the highest level).
+     *      e.g. 0.9 gives the cutoff to be in the top 10%.
+     * @return A level whose rank is within rankError() * count() of q * count(),
+     *      with 99% confidence.
+     * @throws std::out_of_range If the sketch is empty or q is outside [0, 1].
+     */
+    size_t quantile(const double& q) const;
+
+    /**
+     * @brief Returns the rank error bound of quantile(), as a fraction of count().
+     *
+     * Uses the empirical bound for KLL sketches at 99% confidence, 2.296 / k^0.9723
+     * (from Apache DataSketches), e.g. ~1.3% for the default k.
+     */
+    double rankError() const;
+
+    /**
+     * @brief Returns the number of levels the sketch has seen.
+     */
+    size_t count() const;
+
+    /**
+     * @brief Returns the number of levels the sketch currently keeps,
+     *        each taking sizeof(size_t) bytes.
+     */
+    size_t retained() const;
+
+private:
+    size_t k_;
+    size_t count_; // the number of levels seen
+    size_t retained_; // the number of levels kept, ie. across all compactors
+    size_t capacity_; // the sum of every compactor's capacity
+    std::vector<std::vector<size_t>> compactors_; // compactor h holds levels of weight 2^h
+    std::minstd_rand random_;
+
+    /**
+     * @brief Returns the capacity of compactor h, given the current number of compactors.
+     */
+    size_t capacity(const size_t& h) const;
+
+    /**
+     * @brief Adds a compactor on top & recomputes capacity_.
+     */
+    void grow();
+
+    /**
+     * @brief Compacts compactors until the retained levels fit in capacity_.
+     */
+    void compress();
+
+    /**
+     * @brief Promotes every other level of compactor h to compactor h + 1.
+     */
+    void compact(const size_t& h);
+};
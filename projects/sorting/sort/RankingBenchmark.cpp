@@ -0,0 +1,246 @@
+/**
+ * @file RankingBenchmark.cpp
+ * @brief Times every ranking engine on the same inputs, over repeated trials,
+ * for input sizes from 1e3 up to a maximum & four distributions of levels:
+ * random, sorted, reverse-sorted & few distinct levels (many duplicates).
+ *
+ * Every row reports the median & 99th percentile wall time of a call, the throughput
+ * (millions of players per second at the median) & the peak heap memory allocated during a call,
+ * which is tracked by replacing the global operator new & delete.
+ * The Offline engines rank the top 10%; the Online engines use an interval of 10% too.
+ * snapshotRank ranks a PlayerSnapshot of each input, written & mapped once per input outside
+ * the timing; its peak memory is heap only, not the mapping.
+ *
+ * Build & run with, for example:
+ *   g++ -std=c++17 -O2 RankingBenchmark.cpp Leaderboard.cpp Player.cpp PlayerSnapshot.cpp PlayerStream.cpp QuantileSketch.cpp -o ranking_benchmark -lpthread
+ *   ./ranking_benchmark [max size] [trials] [seed]
+ * e.g. ./ranking_benchmark 100000000 5 for sizes up to 1e8 (~5 GB of Players per input).
+ */
+
+#include "Leaderboard.hpp"
+#include "Player.hpp"
+#include "PlayerSnapshot.hpp"
+#include "PlayerStream.hpp"
+#include "QuantileSketch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Inputs up to this size are still ranked by engines that go quadratic (& recurse
+// as deep as the input) on sorted or duplicate-heavy input; larger ones are skipped
+const size_t QUADRATIC_LIMIT = 10000;
+
+// Bytes currently allocated through operator new, & the most since the last reset
+std::atomic<size_t> live_bytes(0);
+std::atomic<size_t> peak_bytes(0);
+
+// Every allocation is prefixed by its size, keeping the default new alignment
+const size_t HEADER = alignof(std::max_align_t);
+
+enum class Distribution { Random, Sorted, Reverse, Duplicates };
+
+/**
+ * @brief A ranking engine & whether it degrades to O(N^2) on non-random input.
+ */
+struct Engine {
+    std::string name_;
+    bool quadratic_;
+    std::function<RankingResult(std::vector<Player>&)> run_; // may consume its input
+};
+
+std::string label(const Distribution& distribution) {
+    switch (distribution) {
+    case Distribution::Random: return "random";
+    case Distribution::Sorted: return "sorted";
+    case Distribution::Reverse: return "reverse";
+    default: return "duplicates";
+    }
+}
+
+/**
+ * @brief Generates `count` Players with distinct ids & names, whose levels follow a distribution.
+ */
+std::vector<Player> generate(const size_t& count, const Distribution& distribution, std::mt19937_64& random) {
+    std::vector<Player> players;
+    players.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        size_t level;
+        switch (distribution) {
+        case Distribution::Random: level = random() % 1000000000; break;
+        case Distribution::Sorted: level = i; break;
+        case Distribution::Reverse: level = count - i; break;
+        default: level = random() % 16; break;
+        }
+        players.push_back(Player("Player" + std::to_string(i), level, i));
+    }
+    return players;
+}
+
+/**
+ * @brief Returns the nearest-rank p-th percentile of some sorted times.
+ */
+double percentile(const std::vector<double>& sorted, const double& p) {
+    size_t rank = std::max<size_t>(1, std::ceil(p * sorted.size()));
+    return sorted[rank - 1];
+}
+
+/**
+ * @brief Times an engine on copies of an input & prints one row of results.
+ * @return A checksum of the results, so the calls cannot be optimized out.
+ */
+size_t run(const Engine& engine, const std::vector<Player>& input, const Distribution& distribution, const size_t& trials) {
+    std::vector<double> times;
+    size_t peak = 0, checksum = 0;
+
+    for (size_t trial = 0; trial < trials; trial++) {
+        std::vector<Player> players = input; // copied outside the timing
+
+        size_t before = live_bytes.load();
+        peak_bytes.store(before);
+        auto start = Clock::now();
+        RankingResult result = engine.run_(players);
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        peak = std::max(peak, peak_bytes.load() - before);
+
+        checksum += result.top_.size() + result.cutoffs_.size();
+        if (!result.top_.empty()) {
+            checksum += result.top_.front().level_;
+        }
+    }
+    std::sort(times.begin(), times.end());
+
+    double p50 = percentile(times, 0.50);
+    std::cout << std::left << std::setw(24) << engine.name_ << std::setw(12) << label(distribution) << std::right
+              << std::setw(11) << input.size() << std::setw(12) << p50 << std::setw(12) << percentile(times, 0.99)
+              << std::setw(14) << input.size() / p50 / 1000 << std::setw(12) << peak / (1024.0 * 1024.0) << std::endl;
+    return checksum;
+}
+
+}
+
+void* operator new(size_t size) {
+    void* block = std::malloc(size + HEADER);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<size_t*>(block) = size;
+
+    size_t live = live_bytes.fetch_add(size) + size;
+    size_t peak = peak_bytes.load();
+    while (live > peak && !peak_bytes.compare_exchange_weak(peak, live)) {}
+    return static_cast<char*>(block) + HEADER;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        void* block = static_cast<char*>(pointer) - HEADER;
+        live_bytes.fetch_sub(*static_cast<size_t*>(block));
+        std::free(block);
+    }
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete[](void* pointer) noexcept {
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+int main(int argc, char** argv) {
+    const size_t max_size = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t trials = (argc > 2) ? std::max(1ull, std::strtoull(argv[2], nullptr, 10)) : 5;
+    const std::uint64_t seed = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 1;
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    const std::string snapshot_path = (std::filesystem::temp_directory_path() / "ranking_benchmark.snap").string();
+    std::unique_ptr<PlayerSnapshot> snapshot; // of the current input
+
+    std::vector<Engine> engines = {
+        { "heapRank", false, [](std::vector<Player>& players) { return Offline::heapRank(players); } },
+        { "quickSelectRank", true, [](std::vector<Player>& players) { return Offline::quickSelectRank(players); } },
+        { "introSelectRank", false, [](std::vector<Player>& players) { return Offline::introSelectRank(players); } },
+        { "keyRank", false, [](std::vector<Player>& players) { return Offline::keyRank(players); } },
+        { "snapshotRank", false, [&snapshot](std::vector<Player>&) { return Offline::snapshotRank(*snapshot); } },
+        { "rankIncoming", false, [](std::vector<Player>& players) {
+            size_t interval = std::max<size_t>(1, players.size() / 10);
+            VectorPlayerStream stream(std::move(players));
+            return Online::rankIncoming(stream, interval);
+        } },
+        { "rankIncomingParallel", false, [workers](std::vector<Player>& players) {
+            size_t interval = std::max<size_t>(1, players.size() / 10);
+            VectorPlayerStream stream(std::move(players));
+            return Online::rankIncomingParallel(stream, interval, workers);
+        } },
+        { "rankWindowed", false, [](std::vector<Player>& players) {
+            size_t interval = std::max<size_t>(1, players.size() / 10);
+            VectorPlayerStream stream(std::move(players));
+            return Online::rankWindowed(stream, interval, 2 * interval);
+        } },
+        { "sketchIncoming", false, [](std::vector<Player>& players) {
+            size_t interval = std::max<size_t>(1, players.size() / 10);
+            VectorPlayerStream stream(std::move(players));
+            QuantileSketch sketch;
+            return Online::sketchIncoming(stream, interval, sketch);
+        } },
+    };
+    const std::vector<Distribution> distributions = {
+        Distribution::Random, Distribution::Sorted, Distribution::Reverse, Distribution::Duplicates
+    };
+
+    std::cout << trials << " trials per row, seed " << seed << ", " << workers << " workers" << std::endl;
+    std::cout << std::left << std::setw(24) << "engine" << std::setw(12) << "input" << std::right
+              << std::setw(11) << "players" << std::setw(12) << "p50 ms" << std::setw(12) << "p99 ms"
+              << std::setw(14) << "Mplayers/s" << std::setw(12) << "peak MB" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    std::mt19937_64 random(seed);
+    size_t checksum = 0;
+    for (size_t size = 1000; size <= max_size; size *= 10) {
+        for (const Distribution& distribution : distributions) {
+            std::vector<Player> input = generate(size, distribution, random);
+            snapshot.reset();
+            writeSnapshot(snapshot_path, input);
+            snapshot = std::make_unique<PlayerSnapshot>(snapshot_path);
+            for (const Engine& engine : engines) {
+                if (engine.quadratic_ && distribution != Distribution::Random && size > QUADRATIC_LIMIT) {
+                    std::cout << std::left << std::setw(24) << engine.name_ << std::setw(12) << label(distribution)
+                              << std::right << std::setw(11) << size << "   skipped (quadratic on this input)" << std::endl;
+                    continue;
+                }
+                checksum += run(engine, input, distribution, trials);
+            }
+        }
+    }
+    snapshot.reset();
+    std::remove(snapshot_path.c_str());
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "SpscRing.hpp"
+
+/**
+ * @brief Constructs an empty ring.
+ * @param capacity The minimum number of values the ring can hold, rounded up to a power of two.
+ */
+template <typename T>
+SpscRing<T>::SpscRing(const size_t& capacity)
+    : head_ { 0 }
+    , cached_tail_ { 0 }
+    , tail_ { 0 }
+    , cached_head_ { 0 }
+{
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    slots_.resize(rounded);
+    mask_ = rounded - 1;
+}
+
+/**
+ * @brief Moves a value onto the back of the ring. Only call from the producer thread.
+ * @param value The value to push.
+ * @return true if the value was pushed, false if the ring is full (`value` is then left untouched).
+ */
+template <typename T>
+bool SpscRing<T>::tryPush(T&& value) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == slots_.size()) {
+        // looks full: see how far the consumer has gotten since we last checked
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == slots_.size()) {
+            return false;
+        }
+    }
+    slots_[tail & mask_] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release); // publishes the slot to the consumer
+    return true;
+}
+
+/**
+ * @brief Moves the value at the front of the ring out. Only call from the consumer thread.
+ * @param value Set to the popped value.
+ * @return true if a value was popped, false if the ring is empty.
+ */
+template <typename T>
+bool SpscRing<T>::tryPop(T& value) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        // looks empty: see how far the producer has gotten since we last checked
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            return false;
+        }
+    }
+    value = std::move(slots_[head & mask_]);
+    head_.store(head + 1, std::memory_order_release); // hands the slot back to the producer
+    return true;
+}
+
+/**
+ * @brief Returns the maximum number of values the ring can hold.
+ */
+template <typename T>
+size_t SpscRing<T>::capacity() const {
+    return slots_.size();
+}
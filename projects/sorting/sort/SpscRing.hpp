@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief A bounded, lock-free queue between exactly one producer thread and one consumer thread.
+ *
+ * Slots are reused in a ring whose capacity is a power of two. The producer only
+ * writes `tail_` & the consumer only writes `head_`, so neither side ever waits on a lock:
+ * a push or pop is a couple of atomic loads, a move, & a release store.
+ * Each side also keeps a cached copy of the other's index, so it only reads
+ * the other core's cache line when the ring looks full (or empty).
+ *
+ * @tparam T The type of the queued values; must be default constructible & movable.
+ */
+template <typename T>
+class SpscRing {
+public:
+    /**
+     * @brief Constructs an empty ring.
+     * @param capacity The minimum number of values the ring can hold, rounded up to a power of two.
+     */
+    explicit SpscRing(const size_t& capacity);
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Moves a value onto the back of the ring. Only call from the producer thread.
+     * @param value The value to push.
+     * @return true if the value was pushed, false if the ring is full (`value` is then left untouched).
+     */
+    bool tryPush(T&& value);
+
+    /**
+     * @brief Moves the value at the front of the ring out. Only call from the consumer thread.
+     * @param value Set to the popped value.
+     * @return true if a value was popped, false if the ring is empty.
+     */
+    bool tryPop(T& value);
+
+    /**
+     * @brief Returns the maximum number of values the ring can hold.
+     */
+    size_t capacity() const;
+
+private:
+    static const size_t CACHE_LINE = 64;
+
+    std::vector<T> slots_;
+    size_t mask_; // capacity - 1, to wrap indices with a bitwise and
+
+    // Both indices only ever increase; a slot is index & mask_.
+    alignas(CACHE_LINE) std::atomic<size_t> head_; // the next slot to pop, written by the consumer
+    size_t cached_tail_; // the consumer's last look at tail_
+
+    alignas(CACHE_LINE) std::atomic<size_t> tail_; // the next slot to push, written by the producer
+    size_t cached_head_; // the producer's last look at head_
+};
+
+#include "SpscRing.cpp"